@@ -64,6 +64,12 @@
 #define CV_DEF_RANGE_ERR_THROWS
 // define to activate by default recursive functions, required if caller function is constexpr
 #define CV_DEF_RECURSIVE
+// define to select by default recursive functions in constant evaluation & iterative ones in runtime (RecursivePolicyAuto)
+#define CV_DEF_RECURSIVE_AUTO
+// define to use SIMD instructions (SSE2 / AVX2) in runtime versions of functions, if supported by target
+#define CV_USE_SIMD
+// define to use by default hash with random per-process seed (hash_code not available in compile time)
+//#define CV_DEF_HASH_SEEDED
 
 // ----------------------------------------------------------------------------
 // Symbol calculation section
@@ -81,12 +87,78 @@
 #undef CV_DEF_RANGE_ERR_THROWS
 #endif // CV_DEF_RANGE_CHECK
 
+#if defined(_MSVC_LANG)
+#define CV_CPLUSPLUS _MSVC_LANG
+#else
+#define CV_CPLUSPLUS __cplusplus
+#endif
+
+// relaxed constexpr functions (with loops & local variables) available since C++14
+#if CV_CPLUSPLUS >= 201402L
+#define CV_HAS_CONSTEXPR14
+#define CV_CONSTEXPR14 constexpr
+#else
+#define CV_CONSTEXPR14
+#endif
+
+// class types (basic_fixed_string) as non-type template parameters available since C++20
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+#define CV_HAS_CLASS_NTTP
+#endif
+
+#ifdef CV_USE_SIMD
+#if defined(__AVX2__)
+#define CV_SIMD_AVX2
+#endif
+#if defined(__SSSE3__) || defined(__AVX2__)
+#define CV_SIMD_SSSE3
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CV_SIMD_SSE2
+#endif
+#endif // CV_USE_SIMD
+
 // ----------------------------------------------------------------------------
 // Includes section
 // ----------------------------------------------------------------------------
 #include <iostream>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
+#include <string>
+#include <cstring>
+#include <array>
+#include <vector>
+#include <initializer_list>
+#include <random>
+#include <chrono>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(CV_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(CV_SIMD_SSSE3)
+#include <tmmintrin.h>
+#elif defined(CV_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+// detection of constant evaluation, used by RecursivePolicyAuto
+#if defined(__cpp_lib_is_constant_evaluated)
+#define CV_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define CV_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif defined(__GNUC__) && (__GNUC__ >= 9)
+#define CV_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#ifdef CV_IS_CONSTANT_EVALUATED
+#define CV_HAS_CONSTANT_EVALUATED
+#endif
 
 namespace sbt
 {
@@ -99,11 +171,19 @@ namespace sbt
 // ----------------------------------------------------------------------------
 // Forward class definitions
 // ----------------------------------------------------------------------------
+template<class charT>
+class basic_char_set;
+
+template<class charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+class basic_char_view;
 
 // ----------------------------------------------------------------------------
 // Constants
 // ----------------------------------------------------------------------------
 
+/// Selects if occurrences reported by count & find_all can overlap ("aa" is found twice in "aaa" if overlapping)
+enum class overlap_mode { non_overlapping, overlapping };
+
 // ----------------------------------------------------------------------------
 // Class definitions
 // ----------------------------------------------------------------------------
@@ -112,6 +192,10 @@ namespace sbt
 struct RecursivePolicyEnabled {};
 /// Policy which enables iterative versions of functions
 struct RecursivePolicyDisabled {};
+/// @brief Policy which selects version of functions by context: recursive (constexpr) versions during constant evaluation,
+/// iterative (SIMD) versions in runtime.
+/// @details Requires std::is_constant_evaluated (C++20) or compiler built-in (GCC 9, Clang 9), otherwise works as RecursivePolicyEnabled.
+struct RecursivePolicyAuto {};
 
 template<typename T>
 struct RecursivePolicyTag {
@@ -125,12 +209,22 @@ struct RecursivePolicyTag<RecursivePolicyEnabled> {
     typedef std::true_type value_type;
 };
 
+template <>
+struct RecursivePolicyTag<RecursivePolicyAuto> {
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    typedef RecursivePolicyAuto type;
+#else
+    typedef RecursivePolicyEnabled type;
+#endif
+    typedef std::true_type value_type;
+};
+
 /// Policy which throws exceptions on error and does not store error information
 template<class charT>
 class ErrorPolicyThrowing {
 protected:
     /// if error returns errorResult, otherwise '\0' (workaround for throwing inside constexpr function)
-    constexpr charT signal_range_check_error(bool error, charT errorResult) {
+    constexpr charT signal_range_check_error(bool error, charT errorResult) const {
        return (!error)?'\0':throw std::runtime_error("ERROR: basic_char_view - index out of bounds");
     }
 };
@@ -140,7 +234,7 @@ template<class charT>
 class ErrorPolicyEmptyValue {
 protected:
     /// if error returns errorResult, otherwise '\0' (workaround for throwing inside constexpr function)
-    constexpr charT signal_range_check_error(bool error, charT errorResult) {
+    constexpr charT signal_range_check_error(bool error, charT errorResult) const {
        return (error)?errorResult:'\0';
     }
 };
@@ -179,7 +273,9 @@ template<class charT = default_char_t>
 using default_error_policy = ErrorPolicyEmptyValue<charT>;
 #endif // CV_DEF_RANGE_ERR_THROWS
 
-#ifdef CV_DEF_RECURSIVE
+#if defined(CV_DEF_RECURSIVE) && defined(CV_DEF_RECURSIVE_AUTO)
+typedef RecursivePolicyAuto default_recursive_policy;
+#elif defined(CV_DEF_RECURSIVE)
 typedef RecursivePolicyEnabled default_recursive_policy;
 #else
 typedef RecursivePolicyDisabled default_recursive_policy;
@@ -194,6 +290,769 @@ typedef RangeCheckPolicyDisabled default_range_check_policy;
 /// Internal namespace - contents not for use outside of library.
 namespace details
 {
+    // Converts ASCII upper case letter to lower case, other characters are returned unchanged
+    template<class charT>
+    constexpr charT lower_ascii(charT ch)
+    {
+        return ((ch >= charT('A')) && (ch <= charT('Z'))) ? static_cast<charT>(ch + ('a' - 'A')) : ch;
+    }
+
+    // Returns character code as unsigned value
+    template<class charT>
+    constexpr typename std::make_unsigned<charT>::type char_code(charT ch)
+    {
+        return static_cast<typename std::make_unsigned<charT>::type>(ch);
+    }
+
+    /// Runtime (non-constexpr) kernels working directly on character buffers.
+    /// Functions from this namespace never allocate memory, for char type they use SIMD instructions if enabled.
+    namespace rt
+    {
+        // Returns position of lowest bit set in mask, mask must be non-zero
+        inline unsigned int bit_scan_forward(unsigned int mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long res;
+            _BitScanForward(&res, mask);
+            return static_cast<unsigned int>(res);
+#else
+            return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+        }
+
+        // Returns position of highest bit set in mask, mask must be non-zero
+        inline unsigned int bit_scan_reverse(unsigned int mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long res;
+            _BitScanReverse(&res, mask);
+            return static_cast<unsigned int>(res);
+#else
+            return static_cast<unsigned int>(31 - __builtin_clz(mask));
+#endif
+        }
+
+        // Find position of a given search string found inside content string.
+        // Candidates are filtered using first and last character of search_text, then middle part is verified.
+        // param[in] content input text to be scanned
+        // param[in] search_text text to be found
+        // param[in] content_limit number of characters in content
+        // param[in] search_limit number of characters in search_text
+        // return Returns -1 if not found, otherwise zero-based position of search_text inside content
+        template<class charT>
+        inline ssize_t index_of(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit)
+        {
+            typedef std::char_traits<charT> traits;
+
+            if (search_limit == 0)
+                return 0;
+            if (search_limit > content_limit)
+                return -1;
+
+            if (search_limit == 1) {
+                const charT *found = traits::find(content, content_limit, search_text[0]);
+                return found ? (found - content) : -1;
+            }
+
+            const size_t last = search_limit - 1;
+            const charT first_ch = search_text[0];
+            const charT last_ch = search_text[last];
+            const size_t end_pos = content_limit - last;
+
+            for(size_t i = 0; i < end_pos; ++i) {
+                if ((content[i] == first_ch) && (content[i + last] == last_ch) &&
+                    (traits::compare(content + i + 1, search_text + 1, last - 1) == 0))
+                    return i;
+            }
+
+            return -1;
+        }
+
+#if defined(CV_SIMD_SSE2)
+        // Converts ASCII upper case letters inside block to lower case
+        inline __m128i lower_ascii_block(__m128i block)
+        {
+            // 'A'..'Z' moved to the lowest signed values: -128..-103
+            const __m128i upper = _mm_cmplt_epi8(_mm_add_epi8(block, _mm_set1_epi8(static_cast<char>(0x80 - 'A'))),
+                                                 _mm_set1_epi8(static_cast<char>(-128 + 26)));
+            return _mm_or_si128(block, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        }
+#endif
+
+#if defined(CV_SIMD_AVX2)
+        // Converts ASCII upper case letters inside block to lower case
+        inline __m256i lower_ascii_block(__m256i block)
+        {
+            const __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 26)),
+                                                    _mm256_add_epi8(block, _mm256_set1_epi8(static_cast<char>(0x80 - 'A'))));
+            return _mm256_or_si256(block, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+        }
+#endif
+
+        // Scans candidate positions [pos, end_pos) of content using SIMD blocks, candidate is a position
+        // where content[i] == first_ch and content[i + last] == last_ch, it is accepted if verify(i) returns true.
+        // If FoldCase is true, content is converted to lower case (ASCII) before compare.
+        // On return pos contains first position which was not scanned (less than one block before end_pos).
+        // return Returns -1 if no candidate was accepted, otherwise its position
+        template<bool FoldCase = false, class Verify>
+        inline ssize_t scan_first_last(const char* content, size_t &pos, size_t end_pos, char first_ch, char last_ch, size_t last, Verify verify)
+        {
+            size_t i = pos;
+
+#if defined(CV_SIMD_AVX2)
+            const __m256i first_ch32 = _mm256_set1_epi8(first_ch);
+            const __m256i last_ch32 = _mm256_set1_epi8(last_ch);
+
+            for(; i + 32 <= end_pos; i += 32) {
+                __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(content + i));
+                __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(content + i + last));
+                if (FoldCase) {
+                    block_first = lower_ascii_block(block_first);
+                    block_last = lower_ascii_block(block_last);
+                }
+                unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first_ch32), _mm256_cmpeq_epi8(block_last, last_ch32))));
+
+                while (mask != 0) {
+                    const size_t found = i + bit_scan_forward(mask);
+                    if (verify(found))
+                        return found;
+                    mask &= mask - 1;
+                }
+            }
+#endif
+
+#if defined(CV_SIMD_SSE2)
+            const __m128i first_ch16 = _mm_set1_epi8(first_ch);
+            const __m128i last_ch16 = _mm_set1_epi8(last_ch);
+
+            for(; i + 16 <= end_pos; i += 16) {
+                __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i));
+                __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i + last));
+                if (FoldCase) {
+                    block_first = lower_ascii_block(block_first);
+                    block_last = lower_ascii_block(block_last);
+                }
+                unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(block_first, first_ch16), _mm_cmpeq_epi8(block_last, last_ch16))));
+
+                while (mask != 0) {
+                    const size_t found = i + bit_scan_forward(mask);
+                    if (verify(found))
+                        return found;
+                    mask &= mask - 1;
+                }
+            }
+#endif
+
+            pos = i;
+            return -1;
+        }
+
+        // Version of index_of for char type with SIMD candidate filter.
+        inline ssize_t index_of(const char* content, const char *search_text, size_t content_limit, size_t search_limit)
+        {
+            if (search_limit == 0)
+                return 0;
+            if (search_limit > content_limit)
+                return -1;
+
+            if (search_limit == 1) {
+                const void *found = std::memchr(content, search_text[0], content_limit);
+                return found ? (static_cast<const char *>(found) - content) : -1;
+            }
+
+            // number of characters in both filters: first & last
+            const size_t last = search_limit - 1;
+            // number of candidate positions
+            const size_t end_pos = content_limit - last;
+            size_t i = 0;
+
+            const ssize_t found = scan_first_last(content, i, end_pos, search_text[0], search_text[last], last,
+                [=](size_t pos) { return std::memcmp(content + pos + 1, search_text + 1, last - 1) == 0; });
+            if (found >= 0)
+                return found;
+
+            const ssize_t res = index_of<char>(content + i, search_text, content_limit - i, search_limit);
+            return (res < 0) ? res : res + i;
+        }
+
+        // Compares n characters of two strings ignoring case of ASCII letters
+        template<class charT>
+        inline bool iequal_n(const charT* content, const charT *search_text, size_t n)
+        {
+            for(size_t i = 0; i < n; ++i)
+                if (lower_ascii(content[i]) != lower_ascii(search_text[i]))
+                    return false;
+            return true;
+        }
+
+        // Version of iequal_n for char type, letters are converted to lower case in SIMD registers.
+        inline bool iequal_n(const char* content, const char *search_text, size_t n)
+        {
+            size_t i = 0;
+
+#if defined(CV_SIMD_AVX2)
+            for(; i + 32 <= n; i += 32) {
+                const __m256i block1 = lower_ascii_block(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(content + i)));
+                const __m256i block2 = lower_ascii_block(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(search_text + i)));
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(block1, block2)) != -1)
+                    return false;
+            }
+#endif
+
+#if defined(CV_SIMD_SSE2)
+            for(; i + 16 <= n; i += 16) {
+                const __m128i block1 = lower_ascii_block(_mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i)));
+                const __m128i block2 = lower_ascii_block(_mm_loadu_si128(reinterpret_cast<const __m128i *>(search_text + i)));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2)) != 0xFFFF)
+                    return false;
+            }
+#endif
+
+            return iequal_n<char>(content + i, search_text + i, n - i);
+        }
+
+        // Find position of search_text inside content ignoring case of ASCII letters.
+        // return Returns -1 if not found, otherwise position of search_text
+        template<class charT>
+        inline ssize_t iindex_of(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit)
+        {
+            if (search_limit == 0)
+                return 0;
+            if (search_limit > content_limit)
+                return -1;
+
+            const charT first_ch = lower_ascii(search_text[0]);
+            const size_t end_pos = content_limit - search_limit + 1;
+            for(size_t i = 0; i < end_pos; ++i) {
+                if ((lower_ascii(content[i]) == first_ch) && iequal_n(content + i + 1, search_text + 1, search_limit - 1))
+                    return i;
+            }
+
+            return -1;
+        }
+
+        // Version of iindex_of for char type with SIMD candidate filter working on lower case blocks.
+        inline ssize_t iindex_of(const char* content, const char *search_text, size_t content_limit, size_t search_limit)
+        {
+            if (search_limit == 0)
+                return 0;
+            if (search_limit > content_limit)
+                return -1;
+
+            const size_t last = search_limit - 1;
+            size_t i = 0;
+
+            const ssize_t found = scan_first_last<true>(content, i, content_limit - last,
+                lower_ascii(search_text[0]), lower_ascii(search_text[last]), last,
+                [=](size_t pos) { return (last < 2) || iequal_n(content + pos + 1, search_text + 1, last - 1); });
+            if (found >= 0)
+                return found;
+
+            const ssize_t res = iindex_of<char>(content + i, search_text, content_limit - i, search_limit);
+            return (res < 0) ? res : res + i;
+        }
+
+        // Calls output(pos) for each occurrence of search_text inside content, in increasing order.
+        // If overlapping is false, search continues after end of each occurrence.
+        // Scanning stops when output returns false.
+        // return Returns number of occurrences passed to output
+        template<class charT, class Output>
+        inline size_t for_each_index_of(const charT* content, size_t content_limit, const charT* search_text, size_t search_limit,
+                                        bool overlapping, Output output)
+        {
+            const size_t step = (overlapping || (search_limit == 0)) ? 1 : search_limit;
+            size_t count = 0;
+
+            for(size_t pos = 0; pos + search_limit <= content_limit; ) {
+                const ssize_t found = index_of(content + pos, search_text, content_limit - pos, search_limit);
+                if (found < 0)
+                    break;
+                ++count;
+                if (!output(pos + found))
+                    break;
+                pos += found + step;
+            }
+
+            return count;
+        }
+
+        // Version of for_each_index_of for char type, all candidates of SIMD block are verified
+        // without restarting search.
+        template<class Output>
+        inline size_t for_each_index_of(const char* content, size_t content_limit, const char* search_text, size_t search_limit,
+                                        bool overlapping, Output output)
+        {
+            if ((search_limit == 0) || (search_limit > content_limit))
+                return for_each_index_of<char>(content, content_limit, search_text, search_limit, overlapping, output);
+
+            const size_t last = search_limit - 1;
+            const size_t step = overlapping ? 1 : search_limit;
+            // first position allowed for next occurrence
+            size_t next = 0;
+            size_t count = 0;
+            bool stopped = false;
+            size_t i = 0;
+
+            scan_first_last(content, i, content_limit - last, search_text[0], search_text[last], last,
+                [&](size_t pos) {
+                    if ((pos < next) || ((last > 1) && (std::memcmp(content + pos + 1, search_text + 1, last - 1) != 0)))
+                        return false;
+                    ++count;
+                    next = pos + step;
+                    stopped = !output(pos);
+                    return stopped;
+                });
+
+            if (stopped)
+                return count;
+
+            const size_t start = (i > next) ? i : next;
+            return count + for_each_index_of<char>(content + start, content_limit - start, search_text, search_limit, overlapping,
+                [&](size_t pos) { return output(start + pos); });
+        }
+
+        // Loads value of type T from unaligned memory
+        template<class T>
+        inline T load_unaligned(const void *ptr)
+        {
+            T res;
+            std::memcpy(&res, ptr, sizeof(res));
+            return res;
+        }
+
+        // Compares Size bytes known in compile time with at most two (overlapping) word loads per buffer.
+        // Kind selects word size: 1 - bytes, 2, 4, 8 - word size in bytes, 0 - memcmp.
+        template<size_t Size, int Kind = (Size < 2) ? 1 : (Size < 4) ? 2 : (Size < 8) ? 4 : (Size <= 16) ? 8 : 0>
+        struct fixed_compare {
+            static bool equal(const char *a, const char *b) {
+                return std::memcmp(a, b, Size) == 0;
+            }
+        };
+
+        template<size_t Size>
+        struct fixed_compare<Size, 1> {
+            static bool equal(const char *a, const char *b) {
+                return (Size == 0) || (a[0] == b[0]);
+            }
+        };
+
+        template<size_t Size>
+        struct fixed_compare<Size, 2> {
+            static bool equal(const char *a, const char *b) {
+                return (load_unaligned<unsigned short>(a) == load_unaligned<unsigned short>(b)) &&
+                       (load_unaligned<unsigned short>(a + Size - 2) == load_unaligned<unsigned short>(b + Size - 2));
+            }
+        };
+
+        template<size_t Size>
+        struct fixed_compare<Size, 4> {
+            static bool equal(const char *a, const char *b) {
+                return (load_unaligned<unsigned int>(a) == load_unaligned<unsigned int>(b)) &&
+                       (load_unaligned<unsigned int>(a + Size - 4) == load_unaligned<unsigned int>(b + Size - 4));
+            }
+        };
+
+        template<size_t Size>
+        struct fixed_compare<Size, 8> {
+            static bool equal(const char *a, const char *b) {
+                return (load_unaligned<unsigned long long>(a) == load_unaligned<unsigned long long>(b)) &&
+                       (load_unaligned<unsigned long long>(a + Size - 8) == load_unaligned<unsigned long long>(b + Size - 8));
+            }
+        };
+
+        // Check if N characters (N known in compile time) are equal in both buffers.
+        template<size_t N, class charT>
+        inline bool fixed_equal(const charT* content, const charT *search_text)
+        {
+            return fixed_compare<N * sizeof(charT)>::equal(reinterpret_cast<const char *>(content), reinterpret_cast<const char *>(search_text));
+        }
+
+        // Find position of search string of length N (known in compile time) inside content.
+        // Every candidate is verified with word compares unrolled for N, without additional loops.
+        // param[in] content input text to be scanned
+        // param[in] content_limit number of characters in content
+        // param[in] search_text N characters to be found
+        // return Returns -1 if not found, otherwise zero-based position of search_text inside content
+        template<size_t N, class charT>
+        inline ssize_t fixed_index_of(const charT* content, size_t content_limit, const charT *search_text, size_t start_pos = 0)
+        {
+            if (N == 0)
+                return start_pos;
+            if (N > content_limit)
+                return -1;
+
+            // for needles up to 8 bytes single word compare is cheaper than first character check
+            const bool check_first = (N * sizeof(charT) > 8);
+            const size_t end_pos = content_limit - N + 1;
+            for(size_t i = start_pos; i < end_pos; ++i) {
+                if ((!check_first || (content[i] == search_text[0])) && fixed_equal<N>(content + i, search_text))
+                    return i;
+            }
+
+            return -1;
+        }
+
+        // Version of fixed_index_of for char type with SIMD filter (broadcast of first & last character).
+        template<size_t N>
+        inline ssize_t fixed_index_of(const char* content, size_t content_limit, const char *search_text)
+        {
+            if ((N < 2) || (N > content_limit))
+                return (N == 1) ? index_of(content, search_text, content_limit, N) : fixed_index_of<N, char>(content, content_limit, search_text);
+
+            size_t i = 0;
+            const ssize_t found = scan_first_last(content, i, content_limit - N + 1, search_text[0], search_text[N - 1], N - 1,
+                [=](size_t pos) { return fixed_equal<N>(content + pos, search_text); });
+            if (found >= 0)
+                return found;
+
+            return fixed_index_of<N, char>(content, content_limit, search_text, i);
+        }
+
+        // Find last position of a given string in content, content is scanned from the end.
+        // Candidates are filtered using first and last character of search_text, then middle part is verified.
+        // param[in] content input text to be scanned
+        // param[in] search_text text to be found
+        // param[in] content_limit number of characters in content
+        // param[in] search_limit number of characters in search_text
+        // return Returns -1 if not found, otherwise zero-based position of search_text inside content
+        template<class charT>
+        inline ssize_t last_index_of(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit)
+        {
+            typedef std::char_traits<charT> traits;
+
+            if (search_limit == 0)
+                return content_limit;
+            if (search_limit > content_limit)
+                return -1;
+
+            const size_t last = search_limit - 1;
+            const charT first_ch = search_text[0];
+            const charT last_ch = search_text[last];
+
+            for(size_t i = content_limit - last; i > 0; ) {
+                --i;
+                if ((content[i] == first_ch) && (content[i + last] == last_ch) &&
+                    ((last < 2) || (traits::compare(content + i + 1, search_text + 1, last - 1) == 0)))
+                    return i;
+            }
+
+            return -1;
+        }
+
+        // Version of last_index_of for char type with SIMD candidate filter, blocks are scanned from the end.
+        inline ssize_t last_index_of(const char* content, const char *search_text, size_t content_limit, size_t search_limit)
+        {
+            if ((search_limit == 0) || (search_limit > content_limit))
+                return last_index_of<char>(content, search_text, content_limit, search_limit);
+
+            const size_t last = search_limit - 1;
+            // candidate positions: [0, end_pos)
+            size_t end_pos = content_limit - last;
+
+#if defined(CV_SIMD_AVX2)
+            const __m256i first_ch32 = _mm256_set1_epi8(search_text[0]);
+            const __m256i last_ch32 = _mm256_set1_epi8(search_text[last]);
+
+            for(; end_pos >= 32; end_pos -= 32) {
+                const size_t i = end_pos - 32;
+                const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(content + i));
+                const __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(content + i + last));
+                unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first_ch32), _mm256_cmpeq_epi8(block_last, last_ch32))));
+
+                while (mask != 0) {
+                    const unsigned int bit = bit_scan_reverse(mask);
+                    const size_t pos = i + bit;
+                    if ((last < 2) || (std::memcmp(content + pos + 1, search_text + 1, last - 1) == 0))
+                        return pos;
+                    mask &= ~(1u << bit);
+                }
+            }
+#endif
+
+#if defined(CV_SIMD_SSE2)
+            const __m128i first_ch16 = _mm_set1_epi8(search_text[0]);
+            const __m128i last_ch16 = _mm_set1_epi8(search_text[last]);
+
+            for(; end_pos >= 16; end_pos -= 16) {
+                const size_t i = end_pos - 16;
+                const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i));
+                const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i + last));
+                unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(block_first, first_ch16), _mm_cmpeq_epi8(block_last, last_ch16))));
+
+                while (mask != 0) {
+                    const unsigned int bit = bit_scan_reverse(mask);
+                    const size_t pos = i + bit;
+                    if ((last < 2) || (std::memcmp(content + pos + 1, search_text + 1, last - 1) == 0))
+                        return pos;
+                    mask &= ~(1u << bit);
+                }
+            }
+#endif
+
+            // remaining candidates at the front
+            return last_index_of<char>(content, search_text, end_pos + last, search_limit);
+        }
+
+        // Check if given string is inside provided content.
+        template<class charT>
+        inline bool contains(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit)
+        {
+            return (index_of(content, search_text, content_limit, search_limit) >= 0);
+        }
+
+        // Sequence accessing characters in natural order
+        template<class charT>
+        struct forward_seq {
+            const charT *m_first;
+            charT operator[](size_t index) const { return m_first[index]; }
+        };
+
+        // Sequence accessing characters in reversed order, starting from last one
+        template<class charT>
+        struct reverse_seq {
+            const charT *m_last;
+            charT operator[](size_t index) const { return *(m_last - index); }
+        };
+
+        // Returns position of character inside shift table (lowest 8 bits of character)
+        template<class charT>
+        inline unsigned char shift_index(charT ch)
+        {
+            return static_cast<unsigned char>(ch);
+        }
+
+        // Precomputed data for search of a single needle in one direction.
+        // Selects algorithm by needle length:
+        // - single character: plain character scan (memchr),
+        // - short needles: Boyer-Moore-Horspool,
+        // - long needles: Two-Way (Crochemore-Perrin) with bad character shift, linear in worst case.
+        // Shift table is indexed by lowest 8 bits of character and contains shifts limited to 255,
+        // so wide characters sharing the same slot only produce shorter (still safe) shifts.
+        template<class charT>
+        struct search_plan {
+            enum algorithm_type { alg_empty, alg_single_char, alg_horspool, alg_two_way };
+            // minimum needle length for Two-Way algorithm
+            enum { two_way_min_size = 32, shift_table_size = 256 };
+            // maximum value of shift table entry
+            static constexpr size_t max_shift = 255;
+
+            algorithm_type m_algorithm;
+            size_t m_suffix;
+            size_t m_period;
+            bool m_periodic;
+            unsigned char m_shift[shift_table_size];
+
+            template<class Seq>
+            void build(Seq needle, size_t needle_size)
+            {
+                m_suffix = 0;
+                m_period = 1;
+                m_periodic = false;
+
+                if (needle_size == 0) {
+                    m_algorithm = alg_empty;
+                    return;
+                }
+
+                if (needle_size == 1) {
+                    m_algorithm = alg_single_char;
+                    return;
+                }
+
+                const unsigned char default_shift = static_cast<unsigned char>((needle_size < max_shift) ? needle_size : max_shift);
+                std::memset(m_shift, default_shift, sizeof(m_shift));
+
+                if (needle_size < two_way_min_size) {
+                    m_algorithm = alg_horspool;
+                    // last character is excluded, so shift is never zero
+                    for(size_t i = 0; i + 1 < needle_size; ++i)
+                        m_shift[shift_index(needle[i])] = static_cast<unsigned char>(needle_size - i - 1);
+                    return;
+                }
+
+                m_algorithm = alg_two_way;
+                // zero shift for last character means: window candidate
+                for(size_t i = 0; i < needle_size; ++i) {
+                    const size_t shift = needle_size - i - 1;
+                    m_shift[shift_index(needle[i])] = static_cast<unsigned char>((shift < max_shift) ? shift : max_shift);
+                }
+
+                m_suffix = critical_factorization(needle, needle_size, m_period);
+
+                m_periodic = true;
+                for(size_t i = 0; i < m_suffix; ++i) {
+                    if (needle[i] != needle[i + m_period]) {
+                        m_periodic = false;
+                        break;
+                    }
+                }
+
+                if (!m_periodic)
+                    m_period = ((m_suffix > needle_size - m_suffix) ? m_suffix : needle_size - m_suffix) + 1;
+            }
+
+            // Returns start of right half of needle, calculates period of right half.
+            template<class Seq>
+            static size_t critical_factorization(Seq needle, size_t needle_size, size_t &period)
+            {
+                const size_t max_suffix = maximal_suffix(needle, needle_size, period, false);
+                size_t period_rev;
+                const size_t max_suffix_rev = maximal_suffix(needle, needle_size, period_rev, true);
+
+                // choose the shorter suffix
+                if (max_suffix_rev + 1 < max_suffix + 1)
+                    return max_suffix + 1;
+
+                period = period_rev;
+                return max_suffix_rev + 1;
+            }
+
+            // Returns position before maximal suffix for a given order (npos = whole string), calculates its period.
+            template<class Seq>
+            static size_t maximal_suffix(Seq needle, size_t needle_size, size_t &period, bool reversed_order)
+            {
+                size_t max_suffix = static_cast<size_t>(-1);
+                size_t j = 0;
+                size_t k = 1;
+                size_t p = 1;
+
+                while (j + k < needle_size) {
+                    const charT a = needle[j + k];
+                    const charT b = needle[max_suffix + k];
+                    if ((reversed_order) ? (b < a) : (a < b)) {
+                        // suffix is smaller, period is entire prefix so far
+                        j += k;
+                        k = 1;
+                        p = j - max_suffix;
+                    } else if (a == b) {
+                        // advance through repetition of the current period
+                        if (k != p) {
+                            ++k;
+                        } else {
+                            j += p;
+                            k = 1;
+                        }
+                    } else {
+                        // suffix is larger, start over from current location
+                        max_suffix = j++;
+                        k = p = 1;
+                    }
+                }
+
+                period = p;
+                return max_suffix;
+            }
+
+            // Find position of needle inside haystack.
+            // return Returns -1 if not found, otherwise zero-based position (in sequence order)
+            template<class HaystackSeq, class NeedleSeq>
+            ssize_t find(HaystackSeq haystack, size_t haystack_size, NeedleSeq needle, size_t needle_size) const
+            {
+                if (needle_size > haystack_size)
+                    return -1;
+
+                switch (m_algorithm) {
+                    case alg_empty:
+                        return 0;
+                    case alg_single_char:
+                        return find_char(haystack, haystack_size, needle[0]);
+                    case alg_horspool:
+                        return find_horspool(haystack, haystack_size, needle, needle_size);
+                    default:
+                        return find_two_way(haystack, haystack_size, needle, needle_size);
+                }
+            }
+
+        private:
+            template<class HaystackSeq>
+            static ssize_t find_char(HaystackSeq haystack, size_t haystack_size, charT ch)
+            {
+                for(size_t i = 0; i < haystack_size; ++i)
+                    if (haystack[i] == ch)
+                        return i;
+                return -1;
+            }
+
+            static ssize_t find_char(forward_seq<charT> haystack, size_t haystack_size, charT ch)
+            {
+                const charT *found = std::char_traits<charT>::find(haystack.m_first, haystack_size, ch);
+                return found ? (found - haystack.m_first) : -1;
+            }
+
+            template<class HaystackSeq, class NeedleSeq>
+            ssize_t find_horspool(HaystackSeq haystack, size_t haystack_size, NeedleSeq needle, size_t needle_size) const
+            {
+                const size_t last = needle_size - 1;
+                const charT last_ch = needle[last];
+                size_t j = 0;
+
+                while (j + needle_size <= haystack_size) {
+                    const charT ch = haystack[j + last];
+                    if (ch == last_ch) {
+                        size_t i = 0;
+                        while ((i < last) && (haystack[j + i] == needle[i]))
+                            ++i;
+                        if (i == last)
+                            return j;
+                    }
+                    j += m_shift[shift_index(ch)];
+                }
+
+                return -1;
+            }
+
+            template<class HaystackSeq, class NeedleSeq>
+            ssize_t find_two_way(HaystackSeq haystack, size_t haystack_size, NeedleSeq needle, size_t needle_size) const
+            {
+                const size_t last = needle_size - 1;
+                // number of characters already known to match at the start of window (periodic needle only)
+                size_t memory = 0;
+                size_t j = 0;
+
+                while (j + needle_size <= haystack_size) {
+                    const size_t shift = m_shift[shift_index(haystack[j + last])];
+                    if (shift > 0) {
+                        memory = 0;
+                        j += shift;
+                        continue;
+                    }
+
+                    // scan right half, including last character (table slots can be shared by wide characters)
+                    size_t i = (m_suffix > memory) ? m_suffix : memory;
+                    while ((i < needle_size) && (needle[i] == haystack[i + j]))
+                        ++i;
+
+                    if (i < needle_size) {
+                        j += i - m_suffix + 1;
+                        memory = 0;
+                        continue;
+                    }
+
+                    // scan left half
+                    i = m_suffix;
+                    while ((i > memory) && (needle[i - 1] == haystack[i - 1 + j]))
+                        --i;
+
+                    if (i <= memory)
+                        return j;
+
+                    j += m_period;
+                    // remember how many repetitions of period on the right half were scanned
+                    memory = m_periodic ? needle_size - m_period : 0;
+                }
+
+                return -1;
+            }
+        };
+
+        template<class charT>
+        constexpr size_t search_plan<charT>::max_shift;
+    }
+
     // struct implementing iterative versions of functions
     template<class charT>
     struct no_inline {
@@ -209,7 +1068,7 @@ namespace details
                 --limit;
             }
 
-            int result = MAGIC_NUM;
+            unsigned int result = MAGIC_NUM;
             while(end_pos > pos) {
               --end_pos;
               result = str[end_pos] ^ (33 * result);
@@ -250,7 +1109,14 @@ namespace details
     template<class charT>
 	size_t constexpr length(const charT* str)
 	{
+#ifdef CV_HAS_CONSTEXPR14
+        size_t len = 0;
+        while (str[len])
+            ++len;
+        return len;
+#else
 		return *str ? 1 + length(str + 1) : 0;
+#endif
 	}
 
     /*
@@ -262,100 +1128,600 @@ namespace details
     template<class charT>
     unsigned int constexpr str_hash(const charT* str, size_t pos = 0, size_t limit = -1)
     {
+#ifdef CV_HAS_CONSTEXPR14
+        size_t end_pos = pos;
+        while ((limit != 0) && str[end_pos]) {
+            ++end_pos;
+            --limit;
+        }
+
+        unsigned int result = 5381;
+        while (end_pos > pos) {
+            --end_pos;
+            result = str[end_pos] ^ (33 * result);
+        }
+        return result;
+#else
         // DJB Hash function (original author unknown)
         //return (limit == 0 || !str[pos]) ? 5381 : (str_hash(str, pos + 1, limit - 1) * 33) ^ str[pos];
         return (limit == 0 || !str[pos]) ? 5381 : str[pos] ^ (33 * str_hash(str, pos + 1, limit - 1));
+#endif
     }
 
-    // Checks if content text is started with a provided search_text.    // param[in] content input text to be scanned
-    // param[in] search_text text to be found, can be zero-ended.
-    // param[in] content_limit number of characters in content
-    // param[in] search_limit number of characters in search_text, -1 if unknown
-    // return Returns true if whole search_text is found at position 0 in content.
-    template<class charT>
-	bool constexpr starts_with(const charT* content, const charT *search_text, size_t content_limit, ssize_t search_limit = -1)
-	{
-		return
-		  (search_limit == 0)?true:
-		     (content_limit == 0)?
-		        (
-                  (search_limit < 0)?
-                     (search_text[0] == '\0'):
-                     false
-                )
-		        :
-                (content[0] != search_text[0])?
-                   (search_text[0] == '\0'):
-                   (!content[0]?true:
-                      starts_with(content + 1, search_text + 1, content_limit - 1, search_limit - 1)
-                   )
-                ;
-	}
+    // 64-bit string hash (wyhash construction), defined on little-endian bytes of character codes,
+    // so results do not depend on build-time / runtime calculation.
+    // Runtime version: rt::hash_chars, both versions must return identical values.
+    constexpr unsigned long long hash_secret0 = 0xa0761d6478bd642fULL;
+    constexpr unsigned long long hash_secret1 = 0xe7037ed1a0b428dbULL;
+    constexpr unsigned long long hash_secret2 = 0x8ebc6af09c88c6e3ULL;
+    constexpr unsigned long long hash_secret3 = 0x589965cc75374cc3ULL;
+
+    // Secret values mixed with input words, generated once per process for seeded hash (fixed_hash_secrets for deterministic one)
+    struct hash_secrets {
+        unsigned long long secret0;
+        unsigned long long secret1;
+        unsigned long long secret2;
+        unsigned long long secret3;
+    };
 
-    // Returns number of characters common in both strings at the start.    // param[in] content input text to be scanned
-    // param[in] search_text second text, can be zero-ended
-    // param[in] content_limit number of characters in content
-    // param[in] search_limit number of characters in search_text, -1 if unknown
-    // param[in] match_len number of common characters already found
-    // return Returns number of common (equal) characters.
-    template<class charT>
-	size_t constexpr common_length(const charT* content, const charT *search_text, size_t content_limit, ssize_t search_limit = -1, size_t match_len = 0)
-	{
-		return
-		  (search_limit == 0)?match_len:
-		     (content_limit == 0)?
-		        match_len:
-                (content[0] != search_text[0])?
-                   match_len:
-                   (!content[0]?match_len:
-                      common_length(content + 1, search_text + 1, content_limit - 1, search_limit - 1, match_len + 1)
-                   )
-                ;
-	}
+    // Secrets of deterministic hash, known in compile time
+    struct fixed_hash_secrets {
+        static constexpr unsigned long long secret0 = hash_secret0;
+        static constexpr unsigned long long secret1 = hash_secret1;
+        static constexpr unsigned long long secret2 = hash_secret2;
+        static constexpr unsigned long long secret3 = hash_secret3;
+    };
 
-    // Checks if content ending part (tail) is equal to a given string.    // param[in] content input text to be scanned
-    // param[in] search_text text to be found.
-    // param[in] content_pos position of last character to be checked inside content
-    // param[in] search_pos position of last character to be checked inside search_text
-    // return Returns true if search_text is equal to last characters of content.
-    template<class charT>
-	bool constexpr ends_with(const charT* content, const charT *search_text,
-                             ssize_t content_pos, ssize_t search_pos)
-	{
-		return
-          (search_pos < 0)?true:
-	    	  (content_pos < 0)?false:
-	             (content[content_pos] != search_text[search_pos])?
-                        false:
-                        ends_with(content, search_text, content_pos - 1, search_pos - 1);
-	}
+    // Returns high 64 bits of 128-bit product, from products of 32-bit halves
+    constexpr unsigned long long mul_hi64_parts(unsigned long long lo_lo, unsigned long long hi_lo,
+                                                unsigned long long lo_hi, unsigned long long hi_hi)
+    {
+        return hi_hi + (hi_lo >> 32) + (((lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi) >> 32);
+    }
 
-    // Compare strings.    // Returns value < 0 if search_text is shorter if first non-matching character has less value than in content text.
-    // Returns value > 0 if search_text is longer if first non-matching character has greater value than in content text.
-    // Returns value == 0 if search_text is equal to content.
-    // param[in] content input text to be scanned
+    // Returns high 64 bits of 128-bit product a * b
+    constexpr unsigned long long mul_hi64(unsigned long long a, unsigned long long b)
+    {
+        return mul_hi64_parts((a & 0xFFFFFFFFULL) * (b & 0xFFFFFFFFULL), (a >> 32) * (b & 0xFFFFFFFFULL),
+                              (a & 0xFFFFFFFFULL) * (b >> 32), (a >> 32) * (b >> 32));
+    }
+
+    // Multiply & fold: xor of low and high part of 128-bit product
+    constexpr unsigned long long hash_mix(unsigned long long a, unsigned long long b)
+    {
+        return (a * b) ^ mul_hi64(a, b);
+    }
+
+    // Returns byte of character string, characters are stored as little-endian codes (ASCII letters in lower case if FoldCase)
+    template<bool FoldCase, class charT>
+    constexpr unsigned long long hash_byte(const charT* str, size_t index)
+    {
+        return (static_cast<unsigned long long>(char_code(FoldCase ? lower_ascii(str[index / sizeof(charT)]) : str[index / sizeof(charT)]))
+                >> (8 * (index % sizeof(charT)))) & 0xFFULL;
+    }
+
+    // Reads little-endian number of count bytes (up to 8) starting from byte index
+    template<bool FoldCase, class charT>
+    constexpr unsigned long long hash_read(const charT* str, size_t index, size_t count)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        unsigned long long res = 0;
+        for(size_t i = count; i > 0; --i)
+            res = (res << 8) | hash_byte<FoldCase>(str, index + i - 1);
+        return res;
+#else
+        return (count == 0) ? 0ULL : (hash_byte<FoldCase>(str, index) | (hash_read<FoldCase>(str, index + 1, count - 1) << 8));
+#endif
+    }
+
+    // Mixes 128-bit product of last input words (lo, hi - its low & high 64 bits) with length
+    template<class Secrets>
+    constexpr unsigned long long hash_final_mum(unsigned long long lo, unsigned long long hi, size_t len, const Secrets &secrets)
+    {
+        return hash_mix(lo ^ secrets.secret0 ^ len, hi ^ secrets.secret1);
+    }
+
+    // Final step of hash: a, b - last input words
+    template<class Secrets>
+    constexpr unsigned long long hash_final(unsigned long long a, unsigned long long b, unsigned long long seed, size_t len,
+                                            const Secrets &secrets)
+    {
+        return hash_final_mum((a ^ secrets.secret1) * (b ^ seed), mul_hi64(a ^ secrets.secret1, b ^ seed), len, secrets);
+    }
+
+    // Hash of up to 16 bytes
+    template<bool FoldCase, class charT, class Secrets>
+    constexpr unsigned long long hash_short(const charT* str, size_t len, unsigned long long seed, const Secrets &secrets)
+    {
+        return (len >= 4) ?
+                  hash_final((hash_read<FoldCase>(str, 0, 4) << 32) | hash_read<FoldCase>(str, (len >> 3) << 2, 4),
+                             (hash_read<FoldCase>(str, len - 4, 4) << 32) | hash_read<FoldCase>(str, len - 4 - ((len >> 3) << 2), 4), seed, len, secrets) :
+               (len > 0) ?
+                  hash_final((hash_byte<FoldCase>(str, 0) << 16) | (hash_byte<FoldCase>(str, len >> 1) << 8) | hash_byte<FoldCase>(str, len - 1), 0, seed, len, secrets) :
+                  hash_final(0, 0, seed, len, secrets);
+    }
+
+    // Hash of remaining 16-byte blocks, last (partial) block is read from end of string
+    template<bool FoldCase, class charT, class Secrets>
+    constexpr unsigned long long hash_tail16(const charT* str, size_t pos, size_t remaining, unsigned long long seed, size_t len,
+                                             const Secrets &secrets)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        for(; remaining > 16; pos += 16, remaining -= 16)
+            seed = hash_mix(hash_read<FoldCase>(str, pos, 8) ^ secrets.secret1, hash_read<FoldCase>(str, pos + 8, 8) ^ seed);
+        return hash_final(hash_read<FoldCase>(str, pos + remaining - 16, 8), hash_read<FoldCase>(str, pos + remaining - 8, 8), seed, len, secrets);
+#else
+        return (remaining > 16) ?
+                  hash_tail16<FoldCase>(str, pos + 16, remaining - 16,
+                                        hash_mix(hash_read<FoldCase>(str, pos, 8) ^ secrets.secret1, hash_read<FoldCase>(str, pos + 8, 8) ^ seed), len, secrets) :
+                  hash_final(hash_read<FoldCase>(str, pos + remaining - 16, 8), hash_read<FoldCase>(str, pos + remaining - 8, 8), seed, len, secrets);
+#endif
+    }
+
+    // Hash of 48-byte blocks using three independent lanes
+    template<bool FoldCase, class charT, class Secrets>
+    constexpr unsigned long long hash_bulk48(const charT* str, size_t pos, size_t remaining,
+                                             unsigned long long seed, unsigned long long see1, unsigned long long see2, size_t len,
+                                             const Secrets &secrets)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        for(; remaining > 48; pos += 48, remaining -= 48) {
+            seed = hash_mix(hash_read<FoldCase>(str, pos, 8) ^ secrets.secret1, hash_read<FoldCase>(str, pos + 8, 8) ^ seed);
+            see1 = hash_mix(hash_read<FoldCase>(str, pos + 16, 8) ^ secrets.secret2, hash_read<FoldCase>(str, pos + 24, 8) ^ see1);
+            see2 = hash_mix(hash_read<FoldCase>(str, pos + 32, 8) ^ secrets.secret3, hash_read<FoldCase>(str, pos + 40, 8) ^ see2);
+        }
+        return hash_tail16<FoldCase>(str, pos, remaining, seed ^ see1 ^ see2, len, secrets);
+#else
+        return (remaining > 48) ?
+                  hash_bulk48<FoldCase>(str, pos + 48, remaining - 48,
+                                        hash_mix(hash_read<FoldCase>(str, pos, 8) ^ secrets.secret1, hash_read<FoldCase>(str, pos + 8, 8) ^ seed),
+                                        hash_mix(hash_read<FoldCase>(str, pos + 16, 8) ^ secrets.secret2, hash_read<FoldCase>(str, pos + 24, 8) ^ see1),
+                                        hash_mix(hash_read<FoldCase>(str, pos + 32, 8) ^ secrets.secret3, hash_read<FoldCase>(str, pos + 40, 8) ^ see2), len, secrets) :
+                  hash_tail16<FoldCase>(str, pos, remaining, seed ^ see1 ^ see2, len, secrets);
+#endif
+    }
+
+    template<bool FoldCase, class charT, class Secrets>
+    constexpr unsigned long long hash_bytes(const charT* str, size_t len, unsigned long long seed, const Secrets &secrets)
+    {
+        return (len <= 16) ? hash_short<FoldCase>(str, len, seed, secrets) :
+               (len > 48) ? hash_bulk48<FoldCase>(str, 0, len, seed, seed, seed, len, secrets) :
+                  hash_tail16<FoldCase>(str, 0, len, seed, len, secrets);
+    }
+
+    // Calculate 64-bit hash of count characters of str (embedded zeros are included).
+    template<class charT, class Secrets = fixed_hash_secrets>
+    constexpr unsigned long long hash_chars(const charT* str, size_t count, unsigned long long seed = 0,
+                                            const Secrets &secrets = Secrets())
+    {
+        return hash_bytes<false>(str, count * sizeof(charT), seed ^ hash_mix(seed ^ secrets.secret0, secrets.secret1), secrets);
+    }
+
+    // Calculate 64-bit hash of count characters of str with ASCII letters converted to lower case.
+    template<class charT, class Secrets = fixed_hash_secrets>
+    constexpr unsigned long long ihash_chars(const charT* str, size_t count, unsigned long long seed = 0,
+                                             const Secrets &secrets = Secrets())
+    {
+        return hash_bytes<true>(str, count * sizeof(charT), seed ^ hash_mix(seed ^ secrets.secret0, secrets.secret1), secrets);
+    }
+
+    namespace rt {
+        // Returns high 64 bits of 128-bit product a * b
+        inline unsigned long long mul_hi64(unsigned long long a, unsigned long long b)
+        {
+#if defined(__SIZEOF_INT128__)
+            return static_cast<unsigned long long>((static_cast<unsigned __int128>(a) * b) >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            return __umulh(a, b);
+#else
+            return details::mul_hi64(a, b);
+#endif
+        }
+
+        inline unsigned long long hash_mix(unsigned long long a, unsigned long long b)
+        {
+            return (a * b) ^ mul_hi64(a, b);
+        }
+
+        // Converts ASCII upper case letters to lower case in all lanes (characters) of word, LaneBytes - size of character.
+        // Lane is upper case letter if its top bit is clear & remaining bits are in range 'A'..'Z' (no carries between lanes).
+        template<size_t LaneBytes>
+        struct ascii_folder {
+            static unsigned long long fold(unsigned long long value)
+            {
+                const unsigned long long ones = ~0ULL / ((1ULL << (8 * LaneBytes)) - 1);
+                const unsigned long long high = ones << (8 * LaneBytes - 1);
+                const unsigned long long low = value & ~high;
+                const unsigned long long not_below_a = low + (high - 'A' * ones);
+                const unsigned long long above_z = low + (high - ('Z' + 1) * ones);
+                const unsigned long long upper = not_below_a & ~above_z & ~value & high;
+                return value | (upper >> (8 * LaneBytes - 6));
+            }
+        };
+
+        // No case conversion
+        template<>
+        struct ascii_folder<0> {
+            static unsigned long long fold(unsigned long long value)
+            {
+                return value;
+            }
+        };
+
+        // Reads little-endian 64-bit word, FoldLane - size of character if case of ASCII letters should be converted, otherwise 0
+        template<size_t FoldLane = 0>
+        inline unsigned long long hash_read8(const unsigned char *ptr)
+        {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            return ascii_folder<FoldLane>::fold(__builtin_bswap64(load_unaligned<unsigned long long>(ptr)));
+#else
+            return ascii_folder<FoldLane>::fold(load_unaligned<unsigned long long>(ptr));
+#endif
+        }
+
+        // Reads little-endian 32-bit word
+        template<size_t FoldLane = 0>
+        inline unsigned long long hash_read4(const unsigned char *ptr)
+        {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            return ascii_folder<FoldLane>::fold(__builtin_bswap32(load_unaligned<unsigned int>(ptr)));
+#else
+            return ascii_folder<FoldLane>::fold(load_unaligned<unsigned int>(ptr));
+#endif
+        }
+
+        // Reads input words a, b of up to 16 bytes
+        template<size_t FoldLane = 0>
+        inline void hash_short_words(const unsigned char *ptr, size_t len, unsigned long long &a, unsigned long long &b)
+        {
+            if (len >= 4) {
+                const size_t shift = (len >> 3) << 2;
+                a = (hash_read4<FoldLane>(ptr) << 32) | hash_read4<FoldLane>(ptr + shift);
+                b = (hash_read4<FoldLane>(ptr + len - 4) << 32) | hash_read4<FoldLane>(ptr + len - 4 - shift);
+            } else if ((len > 0) && (FoldLane == 0)) {
+                a = (static_cast<unsigned long long>(ptr[0]) << 16) | (static_cast<unsigned long long>(ptr[len >> 1]) << 8) | ptr[len - 1];
+                b = 0;
+            } else if (len > 0) {
+                // bytes 0, len / 2, len - 1 are all bytes of input: whole characters are converted before bytes are taken
+                const size_t mid = len >> 1;
+                const unsigned long long word = ascii_folder<FoldLane>::fold(static_cast<unsigned long long>(ptr[0]) |
+                                                                             (static_cast<unsigned long long>(ptr[mid]) << (8 * mid)) |
+                                                                             (static_cast<unsigned long long>(ptr[len - 1]) << (8 * (len - 1))));
+                a = ((word & 0xFF) << 16) | (((word >> (8 * mid)) & 0xFF) << 8) | ((word >> (8 * (len - 1))) & 0xFF);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        }
+
+        // Final step of hash: a, b - last input words
+        template<class Secrets>
+        inline unsigned long long hash_final(unsigned long long a, unsigned long long b, unsigned long long seed, size_t len,
+                                             const Secrets &secrets)
+        {
+            a ^= secrets.secret1;
+            b ^= seed;
+            return hash_mix((a * b) ^ secrets.secret0 ^ len, mul_hi64(a, b) ^ secrets.secret1);
+        }
+
+        // Hashes 48-byte block using three independent lanes
+        template<size_t FoldLane = 0, class Secrets>
+        inline void hash_block48(const unsigned char *pos, unsigned long long &seed, unsigned long long &see1, unsigned long long &see2,
+                                 const Secrets &secrets)
+        {
+            seed = hash_mix(hash_read8<FoldLane>(pos) ^ secrets.secret1, hash_read8<FoldLane>(pos + 8) ^ seed);
+            see1 = hash_mix(hash_read8<FoldLane>(pos + 16) ^ secrets.secret2, hash_read8<FoldLane>(pos + 24) ^ see1);
+            see2 = hash_mix(hash_read8<FoldLane>(pos + 32) ^ secrets.secret3, hash_read8<FoldLane>(pos + 40) ^ see2);
+        }
+
+        // Hashes remaining 16-byte blocks & finishes hash of len bytes, last block is read from end of input
+        // (16 bytes before pos + remaining must be readable)
+        template<size_t FoldLane = 0, class Secrets>
+        inline unsigned long long hash_tail16(const unsigned char *pos, size_t remaining, unsigned long long seed, size_t len,
+                                              const Secrets &secrets)
+        {
+            while (remaining > 16) {
+                seed = hash_mix(hash_read8<FoldLane>(pos) ^ secrets.secret1, hash_read8<FoldLane>(pos + 8) ^ seed);
+                pos += 16;
+                remaining -= 16;
+            }
+            return rt::hash_final(hash_read8<FoldLane>(pos + remaining - 16), hash_read8<FoldLane>(pos + remaining - 8), seed, len, secrets);
+        }
+
+        // Runtime version of hash_bytes, word at a time
+        template<size_t FoldLane = 0, class Secrets>
+        inline unsigned long long hash_bytes(const unsigned char *ptr, size_t len, unsigned long long seed, const Secrets &secrets)
+        {
+            if (len <= 16) {
+                unsigned long long a, b;
+                hash_short_words<FoldLane>(ptr, len, a, b);
+                return rt::hash_final(a, b, seed, len, secrets);
+            }
+
+            const unsigned char *pos = ptr;
+            size_t remaining = len;
+            if (remaining > 48) {
+                unsigned long long see1 = seed, see2 = seed;
+                do {
+                    hash_block48<FoldLane>(pos, seed, see1, see2, secrets);
+                    pos += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= see1 ^ see2;
+            }
+            return hash_tail16<FoldLane>(pos, remaining, seed, len, secrets);
+        }
+
+        // Runtime version of details::hash_chars, returns identical values.
+        template<class charT, class Secrets = fixed_hash_secrets>
+        inline unsigned long long hash_chars(const charT* str, size_t count, unsigned long long seed = 0,
+                                             const Secrets &secrets = Secrets())
+        {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            // hash is defined on little-endian bytes
+            return details::hash_chars(str, count, seed, secrets);
+#else
+            return hash_bytes(reinterpret_cast<const unsigned char *>(str), count * sizeof(charT),
+                              seed ^ hash_mix(seed ^ secrets.secret0, secrets.secret1), secrets);
+#endif
+        }
+
+        // Runtime version of details::ihash_chars, ASCII letters are converted to lower case in 64-bit words (all characters at once).
+        template<class charT, class Secrets = fixed_hash_secrets>
+        inline unsigned long long ihash_chars(const charT* str, size_t count, unsigned long long seed = 0,
+                                              const Secrets &secrets = Secrets())
+        {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            return details::ihash_chars(str, count, seed, secrets);
+#else
+            return hash_bytes<sizeof(charT)>(reinterpret_cast<const unsigned char *>(str), count * sizeof(charT),
+                                             seed ^ hash_mix(seed ^ secrets.secret0, secrets.secret1), secrets);
+#endif
+        }
+
+        // Generates random hash seed
+        inline unsigned long long random_hash_seed()
+        {
+            std::random_device device;
+            const unsigned long long entropy = (static_cast<unsigned long long>(device()) << 32) ^ device();
+            const unsigned long long clock = static_cast<unsigned long long>(std::chrono::steady_clock::now().time_since_epoch().count());
+            return hash_mix(entropy ^ hash_secret2, clock ^ reinterpret_cast<size_t>(&device) ^ hash_secret3);
+        }
+
+        // Returns random hash seed, generated once per process
+        inline unsigned long long process_hash_seed()
+        {
+            static const unsigned long long seed = random_hash_seed();
+            return seed;
+        }
+
+        // Returns random hash secrets, generated once per process.
+        // With secrets known, input words cancelling them (word ^ secret == 0) collide for any seed.
+        inline const hash_secrets &process_hash_secrets()
+        {
+            static const hash_secrets secrets = { random_hash_seed(), random_hash_seed(), random_hash_seed(), random_hash_seed() };
+            return secrets;
+        }
+
+        // Characters of text-like objects (views, standard strings, zstrings), used by transparent functors
+        template<class charT>
+        inline const charT* text_data(const charT* a_str)
+        {
+            return a_str;
+        }
+
+        template<class charT>
+        inline size_t text_size(const charT* a_str)
+        {
+            return std::char_traits<charT>::length(a_str);
+        }
+
+        template<class Text>
+        inline auto text_data(const Text &a_str) -> decltype(a_str.data())
+        {
+            return a_str.data();
+        }
+
+        template<class Text>
+        inline auto text_size(const Text &a_str) -> decltype(a_str.size())
+        {
+            return a_str.size();
+        }
+
+        // Compares two character buffers like std::basic_string::compare
+        template<class charT>
+        inline int text_compare(const charT* a_str1, size_t a_len1, const charT* a_str2, size_t a_len2)
+        {
+            const int res = std::char_traits<charT>::compare(a_str1, a_str2, (a_len1 < a_len2) ? a_len1 : a_len2);
+            return (res != 0) ? res : (a_len1 < a_len2) ? -1 : (a_len1 > a_len2) ? 1 : 0;
+        }
+
+        // Calculates hash_chars(in[i].data(), in[i].size(), seed, secrets) for count views, one view after another.
+        // Characters of views processed a few iterations later are prefetched, so cache misses
+        // of scattered keys overlap instead of stalling each hash.
+        template<class charT, class View, class Secrets, class Out>
+        inline void hash_batch(const View* in, size_t count, unsigned long long seed, const Secrets &secrets, Out* out)
+        {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            for(size_t i = 0; i < count; ++i)
+                out[i] = hash_chars(in[i].data(), in[i].size(), seed, secrets);
+#else
+            enum { prefetch_distance = 8 };
+            static const unsigned char hash_padding[4] = { 0, 0, 0, 0 };
+            const unsigned long long mixed_seed = seed ^ hash_mix(seed ^ secrets.secret0, secrets.secret1);
+            for(size_t i = 0; i < count; ++i) {
+#if defined(__GNUC__)
+                if (i + prefetch_distance < count)
+                    __builtin_prefetch(in[i + prefetch_distance].data());
+#elif defined(CV_SIMD_SSE2)
+                if (i + prefetch_distance < count)
+                    _mm_prefetch(reinterpret_cast<const char *>(in[i + prefetch_distance].data()), _MM_HINT_T0);
+#endif
+                const unsigned char *ptr = reinterpret_cast<const unsigned char *>(in[i].data());
+                const size_t len = in[i].size() * sizeof(charT);
+                if (len <= 16) {
+                    // both variants of reading are calculated (from padding if too short) & selected without branches
+                    const bool small = (len >= 4);
+                    const unsigned char *small_ptr = small ? ptr : hash_padding;
+                    const size_t small_len = small ? len : 4;
+                    const size_t shift = (small_len >> 3) << 2;
+                    const unsigned long long small_a = (hash_read4(small_ptr) << 32) | hash_read4(small_ptr + shift);
+                    const unsigned long long small_b = (hash_read4(small_ptr + small_len - 4) << 32) | hash_read4(small_ptr + small_len - 4 - shift);
+                    const unsigned char *tiny_ptr = (len != 0) ? ptr : hash_padding;
+                    const unsigned long long tiny_a = (static_cast<unsigned long long>(tiny_ptr[0]) << 16) |
+                                                      (static_cast<unsigned long long>(tiny_ptr[len >> 1]) << 8) |
+                                                      tiny_ptr[len - (len != 0)];
+                    out[i] = rt::hash_final(small ? small_a : tiny_a, small ? small_b : 0, mixed_seed, len, secrets);
+                } else {
+                    out[i] = hash_bytes(ptr, len, mixed_seed, secrets);
+                }
+            }
+#endif
+        }
+    }
+
+    // Checks if content text is started with a provided search_text.    // param[in] content input text to be scanned
     // param[in] search_text text to be found, can be zero-ended.
     // param[in] content_limit number of characters in content
-    // param[in] search_limit number of characters in search_text
-    // return Returns integer compare result.
+    // param[in] search_limit number of characters in search_text, -1 if unknown
+    // return Returns true if whole search_text is found at position 0 in content.
+    template<class charT>
+	bool constexpr starts_with(const charT* content, const charT *search_text, size_t content_limit, ssize_t search_limit = -1)
+	{
+#ifdef CV_HAS_CONSTEXPR14
+        for(;; ++content, ++search_text, --content_limit, --search_limit) {
+            if ((search_limit == 0) || ((search_limit < 0) && (search_text[0] == '\0')))
+                return true;
+            if ((content_limit == 0) || (content[0] != search_text[0]))
+                return false;
+        }
+#else
+		return
+		  ((search_limit == 0) || ((search_limit < 0) && (search_text[0] == '\0')))?true:
+		     ((content_limit == 0) || (content[0] != search_text[0]))?false:
+                starts_with(content + 1, search_text + 1, content_limit - 1, search_limit - 1)
+                ;
+#endif
+	}
+
+    // Returns number of characters common in both strings at the start.    // param[in] content input text to be scanned
+    // param[in] search_text second text, can be zero-ended
+    // param[in] content_limit number of characters in content
+    // param[in] search_limit number of characters in search_text, -1 if unknown
+    // param[in] match_len number of common characters already found
+    // return Returns number of common (equal) characters.
+    template<class charT>
+	size_t constexpr common_length(const charT* content, const charT *search_text, size_t content_limit, ssize_t search_limit = -1, size_t match_len = 0)
+	{
+#ifdef CV_HAS_CONSTEXPR14
+        for(size_t i = 0; (search_limit != 0) && (content_limit != 0); ++i, --content_limit, --search_limit, ++match_len)
+            if ((content[i] != search_text[i]) || ((search_limit < 0) && !search_text[i]))
+                break;
+        return match_len;
+#else
+		return
+		  (search_limit == 0)?match_len:
+		     (content_limit == 0)?
+		        match_len:
+                ((content[0] != search_text[0]) || ((search_limit < 0) && !search_text[0]))?
+                   match_len:
+                   common_length(content + 1, search_text + 1, content_limit - 1, search_limit - 1, match_len + 1)
+                ;
+#endif
+	}
+
+    // Checks if content ending part (tail) is equal to a given string.    // param[in] content input text to be scanned
+    // param[in] search_text text to be found.
+    // param[in] content_pos position of last character to be checked inside content
+    // param[in] search_pos position of last character to be checked inside search_text
+    // return Returns true if search_text is equal to last characters of content.
+    template<class charT>
+	bool constexpr ends_with(const charT* content, const charT *search_text,
+                             ssize_t content_pos, ssize_t search_pos)
+	{
+#ifdef CV_HAS_CONSTEXPR14
+        for(; search_pos >= 0; --content_pos, --search_pos)
+            if ((content_pos < 0) || (content[content_pos] != search_text[search_pos]))
+                return false;
+        return true;
+#else
+		return
+          (search_pos < 0)?true:
+	    	  (content_pos < 0)?false:
+	             (content[content_pos] != search_text[search_pos])?
+                        false:
+                        ends_with(content, search_text, content_pos - 1, search_pos - 1);
+#endif
+	}
+
+    // Compares n characters of two strings ignoring case of ASCII letters
+    template<class charT>
+    constexpr bool iequal_n(const charT* content, const charT *search_text, size_t n)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        for(size_t i = 0; i < n; i++)
+            if (lower_ascii(content[i]) != lower_ascii(search_text[i]))
+                return false;
+        return true;
+#else
+        return (n == 0) ? true :
+                  (lower_ascii(content[0]) != lower_ascii(search_text[0])) ? false :
+                     iequal_n(content + 1, search_text + 1, n - 1);
+#endif
+    }
+
+    // Find position of search_text inside content ignoring case of ASCII letters.
+    // return Returns -1 if not found, otherwise position of search_text
+    template<class charT>
+    constexpr ssize_t iindex_of(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit, size_t offset = 0)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        for(; search_limit <= content_limit; ++content, --content_limit, ++offset)
+            if (iequal_n(content, search_text, search_limit))
+                return static_cast<ssize_t>(offset);
+        return -1;
+#else
+        return (search_limit > content_limit) ? -1 :
+                  iequal_n(content, search_text, search_limit) ? static_cast<ssize_t>(offset) :
+                     iindex_of(content + 1, search_text, content_limit - 1, search_limit, offset + 1);
+#endif
+    }
+
+    // Compare strings.    // Returns value < 0 if search_text is shorter if first non-matching character has less value than in content text.
+    // Returns value > 0 if search_text is longer if first non-matching character has greater value than in content text.
+    // Returns value == 0 if search_text is equal to content.
+    // param[in] content input text to be scanned
+    // param[in] search_text text to be found, can be zero-ended.
+    // param[in] content_limit number of characters in content
+    // param[in] search_limit number of characters in search_text, -1 if search_text is zero-ended
+    // return Returns integer compare result, characters are ordered as by std::char_traits<charT>::lt.
     template<class charT>
 	int constexpr compare(const charT* content, const charT *search_text, size_t content_limit, ssize_t search_limit = -1)
 	{
+#ifdef CV_HAS_CONSTEXPR14
+        for(;; ++content, ++search_text, --content_limit, --search_limit) {
+            if ((search_limit == 0) || ((search_limit < 0) && (search_text[0] == '\0')))
+                return (content_limit == 0) ? 0 : 1;
+            if (content_limit == 0)
+                return -1;
+            if (std::char_traits<charT>::lt(search_text[0], content[0]))
+                return 1;
+            if (std::char_traits<charT>::lt(content[0], search_text[0]))
+                return -1;
+        }
+#else
 		return
-		  (search_limit == 0)?
+		  ((search_limit == 0) || ((search_limit < 0) && (search_text[0] == '\0')))?
                  (
                    (content_limit == 0)?0:1
                  )
 	             :
-                 (content_limit == 0)?
-                    (!search_text[0]?0:-1)
-                    :
-                    (content[0] > search_text[0])?1:
-                       (content[0] < search_text[0])?-1:
-                       (!content[0]?0:
+                 (content_limit == 0)?-1:
+                    std::char_traits<charT>::lt(search_text[0], content[0])?1:
+                       std::char_traits<charT>::lt(content[0], search_text[0])?-1:
                           compare(content + 1, search_text + 1, content_limit - 1, search_limit - 1)
-                       )
                 ;
+#endif
 	}
 
     // Check if given string is inside provided content.    // param[in] content input text to be scanned
@@ -365,11 +1731,21 @@ namespace details
     // return Returns true if found, otherwise false.
     template<class charT>
 	bool constexpr contains(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit) {
+#ifdef CV_HAS_CONSTEXPR14
+        for(; content_limit >= search_limit; ++content, --content_limit) {
+            if (content_limit == 0)
+                return (search_limit == 0);
+            if (compare(content, search_text, search_limit, search_limit) == 0)
+                return true;
+        }
+        return false;
+#else
 	    return
 	      (content_limit < search_limit)?false:
              (content_limit == 0)?(search_limit == 0):
                  (compare(content, search_text, search_limit, search_limit) == 0)?true:
                     contains(content + 1, search_text, content_limit - 1, search_limit);
+#endif
 	}
 
     // Find position of a given search string found inside content string.    // param[in] content input text to be scanned
@@ -380,15 +1756,37 @@ namespace details
     // return Returns -1 if not found, otherwise zero-based position of search_text inside content
     template<class charT>
 	ssize_t constexpr index_of(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit, size_t offset = 0) {
+#ifdef CV_HAS_CONSTEXPR14
+        for(; content_limit >= search_limit; ++content, --content_limit, ++offset) {
+            if (content_limit == 0)
+                return (search_limit == 0) ? static_cast<ssize_t>(offset) : -1;
+            if (starts_with(content, search_text, search_limit, search_limit))
+                return static_cast<ssize_t>(offset);
+        }
+        return -1;
+#else
 	    return
 	      (content_limit < search_limit)?-1:
              (content_limit == 0)?
                  ((search_limit == 0)?offset:-1):
                  //(compare(content, search_text, search_limit, search_limit) == 0)?offset:
-                    starts_with(content, search_text, search_limit, search_limit)?offset:
+                    ends_with(content, search_text, static_cast<ssize_t>(search_limit) - 1, static_cast<ssize_t>(search_limit) - 1)?offset:
                        index_of(content + 1, search_text, content_limit - 1, search_limit, offset + 1);
+#endif
 	}
 
+#ifdef CV_HAS_CONSTEXPR14
+    // Check if character is in search_set, gives the same result as index_of(search_set, &ch, search_limit, 1) >= 0
+    template<class charT>
+    constexpr bool set_has_char(const charT *search_set, size_t search_limit, charT ch)
+    {
+        for(size_t i = 0; i < search_limit; i++)
+            if (search_set[i] == ch)
+                return true;
+        return false;
+    }
+#endif
+
     // Find position of first character that is from a given character set.    // param[in] content input text to be scanned
     // param[in] search_set character set
     // param[in] content_limit number of characters in content
@@ -397,12 +1795,21 @@ namespace details
     // return Returns -1 if not found, otherwise zero-based position of character inside content
     template<class charT>
 	ssize_t constexpr index_of_any(const charT* content, const charT *search_set, size_t content_limit, size_t search_limit, size_t offset = 0) {
+#ifdef CV_HAS_CONSTEXPR14
+        if (search_limit == 0)
+            return -1;
+        for(; content_limit != 0; ++content, --content_limit, ++offset)
+            if (set_has_char(search_set, search_limit, content[0]))
+                return static_cast<ssize_t>(offset);
+        return -1;
+#else
 	    return
              (content_limit == 0)?
                  -1:
                  (search_limit == 0?-1:
                    (index_of(search_set, content, search_limit, 1) >= 0)?offset:
                        index_of_any(content + 1, search_set, content_limit - 1, search_limit, offset + 1));
+#endif
 	}
 
     // Find position of first character that is not from a given character set.    // param[in] content input text to be scanned
@@ -413,11 +1820,18 @@ namespace details
     // return Returns -1 if not found, otherwise zero-based position of character inside content
     template<class charT>
 	ssize_t constexpr index_of_nonmatching(const charT* content, const charT *search_set, size_t content_limit, size_t search_limit, size_t offset = 0) {
+#ifdef CV_HAS_CONSTEXPR14
+        for(; content_limit != 0; ++content, --content_limit, ++offset)
+            if (!set_has_char(search_set, search_limit, content[0]))
+                return static_cast<ssize_t>(offset);
+        return (search_limit == 0) ? static_cast<ssize_t>(offset) : -1;
+#else
 	 	    return
              (content_limit == 0)?
                  ((search_limit == 0)?offset:-1):
                  (index_of(search_set, content, search_limit, 1) < 0)?offset:
                      index_of_nonmatching(content + 1, search_set, content_limit - 1, search_limit, offset + 1);
+#endif
 	}
 
     // Find last position of a given string in content.    // param[in] content input text to be scanned
@@ -429,6 +1843,15 @@ namespace details
     // return Returns -1 if not found, otherwise zero-based position of character inside content
     template<class charT>
 	ssize_t constexpr last_index_of(const charT* content, const charT *search_text, size_t content_limit, size_t search_limit, size_t offset = 0, ssize_t found_pos = -1) {
+#ifdef CV_HAS_CONSTEXPR14
+        // scanned from the end: first match is the last one
+        if (content_limit < search_limit)
+            return found_pos;
+        for(size_t pos = content_limit - search_limit + 1; pos-- > 0; )
+            if (compare(content + pos, search_text, search_limit, search_limit) == 0)
+                return static_cast<ssize_t>(offset + pos);
+        return found_pos;
+#else
 	    return
 	      (content_limit < search_limit)?found_pos:
              (content_limit == 0)?
@@ -436,6 +1859,7 @@ namespace details
                  (compare(content, search_text, search_limit, search_limit) == 0)?
                     last_index_of(content + 1, search_text, content_limit - 1, search_limit, offset + 1, offset):
                     last_index_of(content + 1, search_text, content_limit - 1, search_limit, offset + 1, found_pos);
+#endif
 	}
 
     // Find last position in content of character matching any character from a given character set.    // param[in] content input text to be scanned
@@ -447,12 +1871,21 @@ namespace details
     // return Returns -1 if not found, otherwise zero-based position of character inside content
     template<class charT>
 	ssize_t constexpr last_index_of_any(const charT* content, const charT *search_set, size_t content_limit, size_t search_limit, size_t offset = 0, ssize_t found_pos = -1) {
+#ifdef CV_HAS_CONSTEXPR14
+        if (search_limit == 0)
+            return -1;
+        for(size_t pos = content_limit; pos-- > 0; )
+            if (set_has_char(search_set, search_limit, content[pos]))
+                return static_cast<ssize_t>(offset + pos);
+        return found_pos;
+#else
 	    return
              (content_limit == 0)?
                  ((search_limit == 0)?-1:found_pos):
                  (index_of(search_set, content, search_limit, 1) >= 0)?
                     last_index_of_any(content + 1, search_set, content_limit - 1, search_limit, offset + 1, offset):
                     last_index_of_any(content + 1, search_set, content_limit - 1, search_limit, offset + 1, found_pos);
+#endif
 	}
 
     // Find last position in content of character not matching any character from a given character set.    // param[in] content input text to be scanned
@@ -464,12 +1897,19 @@ namespace details
     // return Returns -1 if not found, otherwise zero-based position of character inside content
     template<class charT>
 	ssize_t constexpr last_index_of_nonmatching(const charT* content, const charT *search_set, size_t content_limit, size_t search_limit, size_t offset = 0, ssize_t found_pos = -1) {
+#ifdef CV_HAS_CONSTEXPR14
+        for(size_t pos = content_limit; pos-- > 0; )
+            if (!set_has_char(search_set, search_limit, content[pos]))
+                return static_cast<ssize_t>(offset + pos);
+        return found_pos;
+#else
 	    return
              (content_limit == 0)?
-                 ((search_limit == 0)?offset:found_pos):
+                 found_pos:
                  (index_of(search_set, content, search_limit, 1) < 0)?
                     last_index_of_nonmatching(content + 1, search_set, content_limit - 1, search_limit, offset + 1, offset):
                     last_index_of_nonmatching(content + 1, search_set, content_limit - 1, search_limit, offset + 1, found_pos);
+#endif
 	}
 
     template<typename charT>
@@ -491,46 +1931,682 @@ namespace details
     constexpr const char32_t *white_chars<char32_t>() {
         return U" \t\r\n";
     }
-}
-
-/**
-  * @brief Read-only view for character containers: literals, std::string, char buffers.
-  * Implements compilation-time and runtime-calculated functions.
-  *  * Uses the following template arguments:
-  * - charT: character data type (char, wchar, char16_t etc)
-  * - RecursivePolicy: informs if recursive functions should be used or not (required for compile-time evaluation)
-  * - RangeCheckPolicy: performs (or not) range checking for function arguments
-  * - ErrorPolicy: performs throw (or not) on range check errors (if active)
-  *
-  * Uses function names based on std::string with addition of some functions from Java's string type.
-  *
-  * In general, there are the following function overloads defined:
-  * - f(charT *): for functions expecting that string ends with '\0'
-  * - f(charT *, size_t): for functions expecting strings with specified size (size does not include '\0')
-  * - f_cn(charT *, size_t a_len): overload added to eliminate possibility to mistake this function with std::string equivalent
-  * - f(basic_char_view): for functions handling char_view type (same as "this")
-  * - f(std::basic_string): for functions handling standard strings
-  */
-template<class charT,
-         typename RecursivePolicy = default_recursive_policy,
-         typename RangeCheckPolicy = default_range_check_policy,
-         typename ErrorPolicy = default_error_policy<charT>>
-class basic_char_view: private RangeCheckPolicy, private ErrorPolicy
-{
-	const charT* m_str;
-	const size_t m_size;
 
-    size_t length(const charT* str, RecursivePolicyDisabled) {
-        return details::no_inline<charT>::length(str);
+    // Returns bit mask of characters in zero-ended string, all codes must be lower than 64
+    template<class charT>
+    constexpr unsigned long long low_char_mask(const charT* str)
+    {
+        return (str[0] == 0) ? 0ULL : ((1ULL << char_code(str[0])) | low_char_mask(str + 1));
     }
 
-    constexpr size_t length(const charT* str, RecursivePolicyEnabled) {
-        return details::length(str);
-    }
+    // White space classifier used by trim functions, built from white_chars<charT>() table
+    // of a given character type.
+    template<class charT>
+    struct white_space
+    {
+        static constexpr unsigned long long mask = low_char_mask(white_chars<charT>());
 
-public:
-    typedef const charT *const_iterator;
-    typedef basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy> this_type;
+        static constexpr bool contains(charT ch)
+        {
+            return (char_code(ch) < 64) && (((mask >> char_code(ch)) & 1ULL) != 0);
+        }
+    };
+
+    template<class charT>
+    constexpr unsigned long long white_space<charT>::mask;
+
+    // Returns number of white space characters at front of content
+    template<class charT>
+    constexpr size_t white_space_prefix(const charT* content, size_t content_limit, size_t offset = 0)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        while ((offset != content_limit) && white_space<charT>::contains(content[offset]))
+            ++offset;
+        return offset;
+#else
+        return ((offset == content_limit) || !white_space<charT>::contains(content[offset])) ?
+                  offset :
+                  white_space_prefix(content, content_limit, offset + 1);
+#endif
+    }
+
+    // Returns length of content without white space characters at back
+    template<class charT>
+    constexpr size_t white_space_suffix_start(const charT* content, size_t content_limit)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        while ((content_limit != 0) && white_space<charT>::contains(content[content_limit - 1]))
+            --content_limit;
+        return content_limit;
+#else
+        return ((content_limit == 0) || !white_space<charT>::contains(content[content_limit - 1])) ?
+                  content_limit :
+                  white_space_suffix_start(content, content_limit - 1);
+#endif
+    }
+
+    namespace rt {
+#if defined(CV_SIMD_SSE2)
+        // Returns movemask of white space characters (white_chars) in 16-byte block,
+        // for characters of a given size (1, 2 or 4 bytes) each character sets Size bits.
+        template<size_t Size>
+        inline unsigned int white_space_mask(__m128i block);
+
+        template<>
+        inline unsigned int white_space_mask<1>(__m128i block)
+        {
+            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'))),
+                _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'))))));
+        }
+
+        template<>
+        inline unsigned int white_space_mask<2>(__m128i block)
+        {
+            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi16(block, _mm_set1_epi16(' ')), _mm_cmpeq_epi16(block, _mm_set1_epi16('\t'))),
+                _mm_or_si128(_mm_cmpeq_epi16(block, _mm_set1_epi16('\r')), _mm_cmpeq_epi16(block, _mm_set1_epi16('\n'))))));
+        }
+
+        template<>
+        inline unsigned int white_space_mask<4>(__m128i block)
+        {
+            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi32(block, _mm_set1_epi32(' ')), _mm_cmpeq_epi32(block, _mm_set1_epi32('\t'))),
+                _mm_or_si128(_mm_cmpeq_epi32(block, _mm_set1_epi32('\r')), _mm_cmpeq_epi32(block, _mm_set1_epi32('\n'))))));
+        }
+#endif
+
+        // Returns number of white space characters at front of content, checks 16 bytes at once with SSE2
+        template<class charT>
+        inline size_t white_space_prefix(const charT* content, size_t content_limit)
+        {
+            // most of strings do not start with white space
+            if ((content_limit == 0) || !white_space<charT>::contains(content[0]))
+                return 0;
+
+            size_t i = 1;
+#if defined(CV_SIMD_SSE2)
+            enum { block_chars = 16 / sizeof(charT) };
+            for(; i + block_chars <= content_limit; i += block_chars) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i));
+                const unsigned int mask = ~white_space_mask<sizeof(charT)>(block) & 0xFFFFu;
+                if (mask != 0)
+                    return i + bit_scan_forward(mask) / sizeof(charT);
+            }
+#endif
+            while((i < content_limit) && white_space<charT>::contains(content[i]))
+                ++i;
+            return i;
+        }
+
+        // Returns length of content without white space characters at back, checks 16 bytes at once with SSE2
+        template<class charT>
+        inline size_t white_space_suffix_start(const charT* content, size_t content_limit)
+        {
+            if ((content_limit == 0) || !white_space<charT>::contains(content[content_limit - 1]))
+                return content_limit;
+
+            size_t i = content_limit - 1;
+#if defined(CV_SIMD_SSE2)
+            enum { block_chars = 16 / sizeof(charT) };
+            // block ends before character i, so it starts inside content while i >= block_chars
+            if (content_limit > block_chars) {
+                for(const charT* block_start = content + i - block_chars; ; block_start -= block_chars) {
+                    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block_start));
+                    const unsigned int mask = ~white_space_mask<sizeof(charT)>(block) & 0xFFFFu;
+                    if (mask != 0)
+                        return static_cast<size_t>(block_start - content) + bit_scan_reverse(mask) / sizeof(charT) + 1;
+                    i -= block_chars;
+                    if (i < block_chars)
+                        break;
+                }
+            }
+#endif
+            while((i > 0) && white_space<charT>::contains(content[i - 1]))
+                --i;
+            return i;
+        }
+    }
+
+    // Returns bit for character in given 64-bit word of 256-bit bitmap.
+    // Narrow characters (code < 256) are stored directly, wide ones (code >= 256) are hashed by lowest 8 bits.
+    // param[in] wide true if bitmap for wide characters is calculated
+    template<class charT>
+    constexpr unsigned long long char_set_bit(charT ch, size_t word, bool wide)
+    {
+        return ((char_code(ch) >= 256) != wide) ? 0ULL :
+                  ((char_code(ch) & 255) >> 6) != word ? 0ULL :
+                     (1ULL << (char_code(ch) & 63));
+    }
+
+    // Calculate given 64-bit word of 256-bit character set bitmap.
+    // param[in] str characters of set
+    // param[in] len number of characters in str
+    // param[in] word index of word (0..3)
+    // param[in] wide true if bitmap for wide characters is calculated
+    template<class charT>
+    constexpr unsigned long long char_set_word(const charT* str, size_t len, size_t word, bool wide)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        unsigned long long res = 0;
+        for(size_t i = 0; i < len; i++)
+            res |= char_set_bit(str[i], word, wide);
+        return res;
+#else
+        return (len == 0) ? 0ULL : (char_set_bit(str[0], word, wide) | char_set_word(str + 1, len - 1, word, wide));
+#endif
+    }
+
+    // Check if character is one of characters in str.
+    template<class charT>
+    constexpr bool char_set_has_char(const charT* str, size_t len, charT ch)
+    {
+#ifdef CV_HAS_CONSTEXPR14
+        for(size_t i = 0; i < len; i++)
+            if (str[i] == ch)
+                return true;
+        return false;
+#else
+        return (len == 0) ? false : (str[0] == ch) ? true : char_set_has_char(str + 1, len - 1, ch);
+#endif
+    }
+
+    // Test bit inside 256-bit bitmap
+    constexpr bool test_bitmap(const unsigned long long *bitmap, size_t index)
+    {
+        return ((bitmap[index >> 6] >> (index & 63)) & 1ULL) != 0;
+    }
+
+    // Returns 16-bit row of 256-bit bitmap (w0..w3) with characters having given high nibble
+    constexpr unsigned int bitmap_row(unsigned long long w0, unsigned long long w1, unsigned long long w2, unsigned long long w3, size_t high)
+    {
+        return static_cast<unsigned int>(
+                  (((high >> 2) == 0) ? w0 : ((high >> 2) == 1) ? w1 : ((high >> 2) == 2) ? w2 : w3) >> ((high & 3) * 16)
+               ) & 0xFFFFu;
+    }
+
+    // Returns number of non-empty bitmap rows before row "high"
+    constexpr size_t bitmap_row_rank(unsigned long long w0, unsigned long long w1, unsigned long long w2, unsigned long long w3, size_t high)
+    {
+        return (high == 0) ? 0 :
+                  bitmap_row_rank(w0, w1, w2, w3, high - 1) + ((bitmap_row(w0, w1, w2, w3, high - 1) != 0) ? 1 : 0);
+    }
+
+    // Nibble lookup table for high nibble: each non-empty row (high nibble) gets its own bucket bit.
+    // Returns 0 for empty rows and rows which do not fit into 8 buckets.
+    constexpr unsigned char nibble_table_hi(unsigned long long w0, unsigned long long w1, unsigned long long w2, unsigned long long w3, size_t high)
+    {
+        return ((bitmap_row(w0, w1, w2, w3, high) == 0) || (bitmap_row_rank(w0, w1, w2, w3, high) >= 8)) ? 0 :
+                  static_cast<unsigned char>(1u << bitmap_row_rank(w0, w1, w2, w3, high));
+    }
+
+    // Nibble lookup table for low nibble: bucket bits of all rows containing character with a given low nibble.
+    // param[in] high number of rows to be checked
+    constexpr unsigned char nibble_table_lo(unsigned long long w0, unsigned long long w1, unsigned long long w2, unsigned long long w3, size_t low, size_t high = 16)
+    {
+        return (high == 0) ? 0 :
+                  static_cast<unsigned char>(
+                     (((bitmap_row(w0, w1, w2, w3, high - 1) >> low) & 1u) ? nibble_table_hi(w0, w1, w2, w3, high - 1) : 0) |
+                     nibble_table_lo(w0, w1, w2, w3, low, high - 1));
+    }
+}
+
+/**
+  * @brief Character set prepared for fast membership test, for use with find_first_of & related functions.
+  * Holds 256-bit membership bitmap for narrow characters (code < 256). Wide characters (code >= 256)
+  * are hashed by lowest 8 bits into second bitmap, which rejects most of non-members.
+  * Remaining candidates are verified using character list, which is not copied and must outlive the set.
+  *
+  * For sets with narrow characters from at most 8 different rows of 16 codes (high nibbles) - which
+  * covers typical delimiter sets - nibble lookup tables are prepared, so char_view searches can
+  * classify 16 or 32 characters at once with SSSE3 / AVX2 byte shuffles.
+  *
+  * Can be constructed in compile time:
+  * \code{.cpp}
+  *    constexpr char_set delimiters(",;\t\n");
+  *    size_t pos = line.find_first_of(delimiters);
+  * \endcode
+  */
+template<class charT>
+class basic_char_set
+{
+    typedef unsigned long long word_type;
+
+    const charT* m_str;
+    size_t m_size;
+    word_type m_narrow[4];
+    word_type m_wide_hash[4];
+    unsigned char m_nibble_lo[16];
+    unsigned char m_nibble_hi[16];
+    bool m_nibble_exact;
+
+#define CV_NIBBLE_LO(n) details::nibble_table_lo(n0, n1, n2, n3, n)
+#define CV_NIBBLE_HI(n) details::nibble_table_hi(n0, n1, n2, n3, n)
+    constexpr basic_char_set(const charT* a_str, size_t a_len, word_type n0, word_type n1, word_type n2, word_type n3,
+                             word_type w0, word_type w1, word_type w2, word_type w3):
+        m_str(a_str), m_size(a_len),
+        m_narrow{n0, n1, n2, n3},
+        m_wide_hash{w0, w1, w2, w3},
+        m_nibble_lo{
+            CV_NIBBLE_LO(0), CV_NIBBLE_LO(1), CV_NIBBLE_LO(2), CV_NIBBLE_LO(3),
+            CV_NIBBLE_LO(4), CV_NIBBLE_LO(5), CV_NIBBLE_LO(6), CV_NIBBLE_LO(7),
+            CV_NIBBLE_LO(8), CV_NIBBLE_LO(9), CV_NIBBLE_LO(10), CV_NIBBLE_LO(11),
+            CV_NIBBLE_LO(12), CV_NIBBLE_LO(13), CV_NIBBLE_LO(14), CV_NIBBLE_LO(15)},
+        m_nibble_hi{
+            CV_NIBBLE_HI(0), CV_NIBBLE_HI(1), CV_NIBBLE_HI(2), CV_NIBBLE_HI(3),
+            CV_NIBBLE_HI(4), CV_NIBBLE_HI(5), CV_NIBBLE_HI(6), CV_NIBBLE_HI(7),
+            CV_NIBBLE_HI(8), CV_NIBBLE_HI(9), CV_NIBBLE_HI(10), CV_NIBBLE_HI(11),
+            CV_NIBBLE_HI(12), CV_NIBBLE_HI(13), CV_NIBBLE_HI(14), CV_NIBBLE_HI(15)},
+        m_nibble_exact(details::bitmap_row_rank(n0, n1, n2, n3, 16) <= 8)
+    {
+    }
+#undef CV_NIBBLE_LO
+#undef CV_NIBBLE_HI
+
+public:
+    typedef basic_char_set<charT> this_type;
+
+    /// @brief Constructs set from zero-ended string
+    constexpr explicit basic_char_set(const charT* a_str): basic_char_set(a_str, details::length(a_str)) {
+    }
+
+    /// @brief Constructs set from character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr basic_char_set(const charT* a_str, size_t a_len):
+        basic_char_set(a_str, a_len,
+            details::char_set_word(a_str, a_len, 0, false), details::char_set_word(a_str, a_len, 1, false),
+            details::char_set_word(a_str, a_len, 2, false), details::char_set_word(a_str, a_len, 3, false),
+            details::char_set_word(a_str, a_len, 0, true), details::char_set_word(a_str, a_len, 1, true),
+            details::char_set_word(a_str, a_len, 2, true), details::char_set_word(a_str, a_len, 3, true))
+    {
+    }
+
+    /// @brief Constructs set from character buffer using iterative algorithm (runtime only)
+    /// @param[in] a_len number of characters inside a_str string
+    basic_char_set(const charT* a_str, size_t a_len, RecursivePolicyDisabled):
+        m_str(a_str), m_size(a_len), m_narrow(), m_wide_hash(), m_nibble_lo(), m_nibble_hi(), m_nibble_exact(true)
+    {
+        unsigned int bucket = 0;
+        for(size_t i = 0; i < a_len; ++i) {
+            const size_t code = details::char_code(a_str[i]);
+            word_type *bitmap = (code < 256) ? m_narrow : m_wide_hash;
+            bitmap[(code & 255) >> 6] |= (1ULL << (code & 63));
+
+            if ((code >= 256) || !m_nibble_exact)
+                continue;
+            unsigned char &bucket_bit = m_nibble_hi[code >> 4];
+            if (bucket_bit == 0) {
+                if (bucket >= 8) {
+                    m_nibble_exact = false;
+                    continue;
+                }
+                bucket_bit = static_cast<unsigned char>(1u << bucket++);
+            }
+            m_nibble_lo[code & 15] |= bucket_bit;
+        }
+    }
+
+    /// @brief Constructs set from char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    constexpr explicit basic_char_set(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str):
+        basic_char_set(a_str.data(), a_str.size())
+    {
+    }
+
+    /// returns number of characters used to build set (including duplicates)
+    constexpr size_t size() const { return m_size; }
+
+    /// returns true if set is empty
+    constexpr bool empty() const { return (m_size == 0); }
+
+    /// returns pointer to characters of set
+    constexpr const charT* data() const noexcept { return m_str; }
+
+    /// returns true if nibble tables describe set exactly (narrow characters only)
+    constexpr bool nibble_exact() const { return m_nibble_exact; }
+
+    /// returns nibble lookup table (16 bytes) for low 4 bits of character
+    constexpr const unsigned char *nibble_lo() const { return m_nibble_lo; }
+
+    /// returns nibble lookup table (16 bytes) for high 4 bits of character,
+    /// character belongs to set if (nibble_lo()[low] & nibble_hi()[high]) != 0
+    constexpr const unsigned char *nibble_hi() const { return m_nibble_hi; }
+
+    /// returns true if character belongs to set
+    constexpr bool contains(charT ch) const {
+        return (details::char_code(ch) < 256) ?
+                   details::test_bitmap(m_narrow, details::char_code(ch)) :
+                   (details::test_bitmap(m_wide_hash, details::char_code(ch) & 255) &&
+                    details::char_set_has_char(m_str, m_size, ch));
+    }
+};
+
+typedef basic_char_set<char> char_set;
+typedef basic_char_set<wchar_t> wchar_set;
+typedef basic_char_set<char16_t> char16_set;
+typedef basic_char_set<char32_t> char32_set;
+
+namespace details
+{
+    // Find position of first character that is from a given character set.
+    // param[in] content input text to be scanned
+    // param[in] search_set character set
+    // param[in] content_limit number of characters in content
+    // param[in] offset current position inside content
+    // return Returns -1 if not found, otherwise zero-based position of character inside content
+    template<class charT>
+    ssize_t constexpr index_of_any(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit, size_t offset = 0) {
+#ifdef CV_HAS_CONSTEXPR14
+        for(size_t i = 0; i < content_limit; i++)
+            if (search_set.contains(content[i]))
+                return static_cast<ssize_t>(offset + i);
+        return -1;
+#else
+        return
+            (content_limit == 0)?-1:
+               search_set.contains(content[0])?offset:
+                  index_of_any(content + 1, search_set, content_limit - 1, offset + 1);
+#endif
+    }
+
+    // Find position of first character that is not from a given character set.
+    // return Returns -1 if not found, otherwise zero-based position of character inside content
+    template<class charT>
+    ssize_t constexpr index_of_nonmatching(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit, size_t offset = 0) {
+#ifdef CV_HAS_CONSTEXPR14
+        for(size_t i = 0; i < content_limit; i++)
+            if (!search_set.contains(content[i]))
+                return static_cast<ssize_t>(offset + i);
+        return -1;
+#else
+        return
+            (content_limit == 0)?-1:
+               !search_set.contains(content[0])?offset:
+                  index_of_nonmatching(content + 1, search_set, content_limit - 1, offset + 1);
+#endif
+    }
+
+    // Find last position in content of character matching any character from a given character set.
+    // Content is scanned from the end.
+    // return Returns -1 if not found, otherwise zero-based position of character inside content
+    template<class charT>
+    ssize_t constexpr last_index_of_any(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit) {
+#ifdef CV_HAS_CONSTEXPR14
+        while (content_limit > 0)
+            if (search_set.contains(content[--content_limit]))
+                return static_cast<ssize_t>(content_limit);
+        return -1;
+#else
+        return
+            (content_limit == 0)?-1:
+               search_set.contains(content[content_limit - 1])?content_limit - 1:
+                  last_index_of_any(content, search_set, content_limit - 1);
+#endif
+    }
+
+    // Find last position in content of character not matching any character from a given character set.
+    // Content is scanned from the end.
+    // return Returns -1 if not found, otherwise zero-based position of character inside content
+    template<class charT>
+    ssize_t constexpr last_index_of_nonmatching(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit) {
+#ifdef CV_HAS_CONSTEXPR14
+        while (content_limit > 0)
+            if (!search_set.contains(content[--content_limit]))
+                return static_cast<ssize_t>(content_limit);
+        return -1;
+#else
+        return
+            (content_limit == 0)?-1:
+               !search_set.contains(content[content_limit - 1])?content_limit - 1:
+                  last_index_of_nonmatching(content, search_set, content_limit - 1);
+#endif
+    }
+
+    namespace rt
+    {
+        // Find position of first character that is (Matching = true) or is not (Matching = false) from a given character set.
+        template<bool Matching, class charT>
+        inline ssize_t index_of_set(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit)
+        {
+            for(size_t i = 0; i < content_limit; ++i)
+                if (search_set.contains(content[i]) == Matching)
+                    return i;
+            return -1;
+        }
+
+        // Find last position of character that is (Matching = true) or is not (Matching = false) from a given character set.
+        template<bool Matching, class charT>
+        inline ssize_t last_index_of_set(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit)
+        {
+            for(size_t i = content_limit; i > 0; --i)
+                if (search_set.contains(content[i - 1]) == Matching)
+                    return i - 1;
+            return -1;
+        }
+
+        // Version of index_of_set for char type, classifies blocks of characters with SIMD:
+        // nibble lookup (byte shuffle) for SSSE3 / AVX2, compare with each character for small sets on SSE2.
+        template<bool Matching>
+        inline ssize_t index_of_set(const char* content, const basic_char_set<char> &search_set, size_t content_limit)
+        {
+            size_t i = 0;
+
+#if defined(CV_SIMD_SSSE3)
+            if (search_set.nibble_exact()) {
+                const __m128i table_lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(search_set.nibble_lo()));
+                const __m128i table_hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(search_set.nibble_hi()));
+
+#if defined(CV_SIMD_AVX2)
+                const __m256i table_lo32 = _mm256_broadcastsi128_si256(table_lo);
+                const __m256i table_hi32 = _mm256_broadcastsi128_si256(table_hi);
+                const __m256i nibble_mask32 = _mm256_set1_epi8(0x0f);
+                const __m256i zero32 = _mm256_setzero_si256();
+
+                for(; i + 32 <= content_limit; i += 32) {
+                    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(content + i));
+                    const __m256i lo = _mm256_shuffle_epi8(table_lo32, _mm256_and_si256(block, nibble_mask32));
+                    const __m256i hi = _mm256_shuffle_epi8(table_hi32, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask32));
+                    // bit set for characters outside of set
+                    const unsigned int outside = static_cast<unsigned int>(_mm256_movemask_epi8(
+                        _mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), zero32)));
+                    const unsigned int mask = Matching ? ~outside : outside;
+                    if (mask != 0)
+                        return i + bit_scan_forward(mask);
+                }
+#endif
+
+                const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+                const __m128i zero = _mm_setzero_si128();
+
+                for(; i + 16 <= content_limit; i += 16) {
+                    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i));
+                    const __m128i lo = _mm_shuffle_epi8(table_lo, _mm_and_si128(block, nibble_mask));
+                    const __m128i hi = _mm_shuffle_epi8(table_hi, _mm_and_si128(_mm_srli_epi16(block, 4), nibble_mask));
+                    const unsigned int outside = static_cast<unsigned int>(_mm_movemask_epi8(
+                        _mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero)));
+                    const unsigned int mask = (Matching ? ~outside : outside) & 0xFFFFu;
+                    if (mask != 0)
+                        return i + bit_scan_forward(mask);
+                }
+            }
+#elif defined(CV_SIMD_SSE2)
+            enum { max_compared_chars = 16 };
+            if (search_set.size() <= max_compared_chars) {
+                __m128i set_chars[max_compared_chars];
+                const size_t set_size = search_set.size();
+                for(size_t c = 0; c < set_size; ++c)
+                    set_chars[c] = _mm_set1_epi8(search_set.data()[c]);
+
+                for(; i + 16 <= content_limit; i += 16) {
+                    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(content + i));
+                    __m128i found = _mm_setzero_si128();
+                    for(size_t c = 0; c < set_size; ++c)
+                        found = _mm_or_si128(found, _mm_cmpeq_epi8(block, set_chars[c]));
+                    const unsigned int inside = static_cast<unsigned int>(_mm_movemask_epi8(found));
+                    const unsigned int mask = (Matching ? inside : ~inside) & 0xFFFFu;
+                    if (mask != 0)
+                        return i + bit_scan_forward(mask);
+                }
+            }
+#endif
+
+            const ssize_t res = index_of_set<Matching, char>(content + i, search_set, content_limit - i);
+            return (res < 0) ? res : res + i;
+        }
+
+        template<class charT>
+        inline ssize_t index_of_any(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit)
+        {
+            return index_of_set<true>(content, search_set, content_limit);
+        }
+
+        template<class charT>
+        inline ssize_t index_of_nonmatching(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit)
+        {
+            return index_of_set<false>(content, search_set, content_limit);
+        }
+
+        template<class charT>
+        inline ssize_t last_index_of_any(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit)
+        {
+            return last_index_of_set<true>(content, search_set, content_limit);
+        }
+
+        template<class charT>
+        inline ssize_t last_index_of_nonmatching(const charT* content, const basic_char_set<charT> &search_set, size_t content_limit)
+        {
+            return last_index_of_set<false>(content, search_set, content_limit);
+        }
+    }
+}
+
+/// Hash policy with fixed seed: hash_code is the same in each run & can be calculated in compile time (e.g. for case labels)
+struct HashPolicyDeterministic {
+    static constexpr unsigned long long hash_seed() {
+        return 0;
+    }
+
+    static constexpr details::fixed_hash_secrets hash_secrets() {
+        return details::fixed_hash_secrets();
+    }
+
+    template<class charT>
+    static constexpr unsigned long long hash_chars(const charT* a_str, size_t a_len, RecursivePolicyEnabled) {
+        return details::hash_chars(a_str, a_len);
+    }
+
+    template<class charT>
+    static unsigned long long hash_chars(const charT* a_str, size_t a_len, RecursivePolicyDisabled) {
+        return details::rt::hash_chars(a_str, a_len);
+    }
+
+    template<class charT>
+    static constexpr unsigned long long ihash_chars(const charT* a_str, size_t a_len, RecursivePolicyEnabled) {
+        return details::ihash_chars(a_str, a_len);
+    }
+
+    template<class charT>
+    static unsigned long long ihash_chars(const charT* a_str, size_t a_len, RecursivePolicyDisabled) {
+        return details::rt::ihash_chars(a_str, a_len);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class charT>
+    static constexpr unsigned long long hash_chars(const charT* a_str, size_t a_len, RecursivePolicyAuto) {
+        return CV_IS_CONSTANT_EVALUATED() ? details::hash_chars(a_str, a_len) : details::rt::hash_chars(a_str, a_len);
+    }
+
+    template<class charT>
+    static constexpr unsigned long long ihash_chars(const charT* a_str, size_t a_len, RecursivePolicyAuto) {
+        return CV_IS_CONSTANT_EVALUATED() ? details::ihash_chars(a_str, a_len) : details::rt::ihash_chars(a_str, a_len);
+    }
+#endif
+};
+
+/// @brief Hash policy with random seed & secrets generated once per process, for hash containers with keys from untrusted input.
+/// @details Colliding keys cannot be built from the (public) constants of deterministic hash. Runtime only.
+struct HashPolicySeeded {
+    static unsigned long long hash_seed() {
+        return details::rt::process_hash_seed();
+    }
+
+    static const details::hash_secrets &hash_secrets() {
+        return details::rt::process_hash_secrets();
+    }
+
+    template<class charT, typename RecursivePolicy>
+    static unsigned long long hash_chars(const charT* a_str, size_t a_len, RecursivePolicy) {
+        return details::rt::hash_chars(a_str, a_len, hash_seed(), hash_secrets());
+    }
+
+    template<class charT, typename RecursivePolicy>
+    static unsigned long long ihash_chars(const charT* a_str, size_t a_len, RecursivePolicy) {
+        return details::rt::ihash_chars(a_str, a_len, hash_seed(), hash_secrets());
+    }
+};
+
+#ifdef CV_DEF_HASH_SEEDED
+typedef HashPolicySeeded default_hash_policy;
+#else
+typedef HashPolicyDeterministic default_hash_policy;
+#endif
+
+/**
+  * @brief Read-only view for character containers: literals, std::string, char buffers.
+  * Implements compilation-time and runtime-calculated functions.
+  *  * Uses the following template arguments:
+  * - charT: character data type (char, wchar, char16_t etc)
+  * - RecursivePolicy: informs if recursive functions should be used or not (required for compile-time evaluation)
+  * - RangeCheckPolicy: performs (or not) range checking for function arguments
+  * - ErrorPolicy: performs throw (or not) on range check errors (if active)
+  * - HashPolicy: calculates hash_code (deterministic or seeded with random value)
+  *
+  * Uses function names based on std::string with addition of some functions from Java's string type.
+  *
+  * In general, there are the following function overloads defined:
+  * - f(charT *): for functions expecting that string ends with '\0'
+  * - f(charT *, size_t): for functions expecting strings with specified size (size does not include '\0')
+  * - f_cn(charT *, size_t a_len): overload added to eliminate possibility to mistake this function with std::string equivalent
+  * - f(basic_char_view): for functions handling char_view type (same as "this")
+  * - f(std::basic_string): for functions handling standard strings
+  */
+template<class charT,
+         typename RecursivePolicy = default_recursive_policy,
+         typename RangeCheckPolicy = default_range_check_policy,
+         typename ErrorPolicy = default_error_policy<charT>,
+         typename HashPolicy = default_hash_policy>
+class basic_char_view: private RangeCheckPolicy, private ErrorPolicy
+{
+	const charT* m_str;
+	const size_t m_size;
+
+    size_t length(const charT* str, RecursivePolicyDisabled) const {
+        return details::no_inline<charT>::length(str);
+    }
+
+    constexpr size_t length(const charT* str, RecursivePolicyEnabled) const {
+        return details::length(str);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    // RecursivePolicyAuto: recursive (constexpr) version in constant evaluation, iterative version in runtime
+    constexpr size_t length(const charT* str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? details::length(str) : details::no_inline<charT>::length(str);
+    }
+#endif
+
+    // builds character set using iterative algorithm
+    static basic_char_set<charT> make_char_set(const charT* a_str, size_t a_len) {
+        return basic_char_set<charT>(a_str, a_len, RecursivePolicyDisabled());
+    }
+
+public:
+    typedef charT value_type;
+    typedef const charT *const_iterator;
+    typedef basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> this_type;
+    typedef RecursivePolicy recursive_policy;
+    typedef HashPolicy hash_policy;
 
     /// null position (undefined)
     static const size_t npos = -1;
@@ -631,7 +2707,7 @@ public:
                             this_type::signal_range_check_error(true, '\0')):
                   this_type(
                               m_str + index,
-                              (index + len <= m_size)?
+                              (len <= m_size - index)?
                                 len:
                                 m_size - index
                            )
@@ -649,6 +2725,37 @@ private:
         return (a_last_pos == this_type::npos)?this_type(m_str,0):substr(0, a_last_pos + 1);
     }
 
+    // returns characters from a_pos till end, a_pos must not be greater than size
+    constexpr this_type substr_tail(size_t a_pos) const {
+        return this_type(m_str + a_pos, m_size - a_pos);
+    }
+
+    this_type trim_left(RecursivePolicyDisabled) const {
+        return substr_tail(details::rt::white_space_prefix(m_str, m_size));
+    }
+
+    constexpr this_type trim_left(RecursivePolicyEnabled) const {
+        return substr_tail(details::white_space_prefix(m_str, m_size));
+    }
+
+    this_type trim_right(RecursivePolicyDisabled) const {
+        return this_type(m_str, details::rt::white_space_suffix_start(m_str, m_size));
+    }
+
+    constexpr this_type trim_right(RecursivePolicyEnabled) const {
+        return this_type(m_str, details::white_space_suffix_start(m_str, m_size));
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    constexpr this_type trim_left(RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? trim_left(RecursivePolicyEnabled()) : trim_left(RecursivePolicyDisabled());
+    }
+
+    constexpr this_type trim_right(RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? trim_right(RecursivePolicyEnabled()) : trim_right(RecursivePolicyDisabled());
+    }
+#endif
+
 public:
     /// \defgroup trim
     /// @brief Returns substring with omitted white space characters at front and at back
@@ -669,7 +2776,7 @@ public:
     //@{
     /// @brief Returns substring with omitted white space characters at front
     constexpr this_type trim_left() const {
-       return substr_npos_pos(find_first_not_of(details::white_chars<charT>()), m_size);
+       return trim_left(typename RecursivePolicyTag<RecursivePolicy>::type());
     }
 
     /// Overload with charset provided
@@ -683,7 +2790,7 @@ public:
     //@{
     /// @brief Returns substring with omitted white space characters at back
     constexpr this_type trim_right() const {
-       return substr_npos_last(find_last_not_of(details::white_chars<charT>()));
+       return trim_right(typename RecursivePolicyTag<RecursivePolicy>::type());
     }
 
     /// Overload with charset provided
@@ -712,26 +2819,22 @@ public:
         return m_str + m_size;
     }
 
-private:
-    unsigned int hash_code(RecursivePolicyDisabled) const {
-        return details::no_inline<charT>::str_hash_loop(m_str, 0, m_size);
-    }
-
-    constexpr unsigned int hash_code(RecursivePolicyEnabled) const {
-        return details::str_hash(m_str, 0, m_size);
+    /// @brief Calculate 64-bit hash value for contained string.
+    /// @details Note: values are not unique and can be equal for different strings (but it's difficult to achieve).
+    /// With deterministic HashPolicy compile-time and runtime versions return the same values, so hash_code of literals can be used as case labels.
+    constexpr unsigned long long hash_code() const {
+        return HashPolicy::hash_chars(m_str, m_size, typename RecursivePolicyTag<RecursivePolicy>::type());
     }
 
-public:
-    /// @brief Calculate hash value for contained string.
-    /// @details Note: values are not unique and can be equal for different strings (but it's difficult to achieve).
-    constexpr unsigned int hash_code() const {
-        return hash_code(typename RecursivePolicyTag<RecursivePolicy>::type());
+    /// @brief Calculate 64-bit case-insensitive hash value: hash of text with ASCII letters converted to lower case.
+    /// @details Consistent with iequals: views which are iequal have equal ihash_code.
+    constexpr unsigned long long ihash_code() const {
+        return HashPolicy::ihash_chars(m_str, m_size, typename RecursivePolicyTag<RecursivePolicy>::type());
     }
 
 private:
     bool starts_with(const charT* a_str, RecursivePolicyDisabled) const {
-        std::basic_string<charT> str(a_str);
-        return (str.substr(0, m_size) == std::basic_string<charT>(m_str, str.size()));
+        return starts_with(a_str, std::char_traits<charT>::length(a_str), RecursivePolicyDisabled());
     }
 
     constexpr bool starts_with(const charT* a_str, RecursivePolicyEnabled) const {
@@ -739,8 +2842,7 @@ private:
     }
 
     bool starts_with(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        std::basic_string<charT> str(a_str, std::min(a_len, m_size));
-        return (str == std::basic_string<charT>(m_str, m_size));
+        return (a_len <= m_size) && (std::char_traits<charT>::compare(m_str, a_str, a_len) == 0);
     }
 
     constexpr bool starts_with(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
@@ -748,7 +2850,7 @@ private:
     }
 
     bool starts_with(const this_type &a_str, RecursivePolicyDisabled) const {
-        return (a_str == substr(0, a_str.size()));
+        return starts_with(a_str.m_str, a_str.m_size, RecursivePolicyDisabled());
     }
 
     constexpr bool starts_with(const this_type &a_str, RecursivePolicyEnabled) const {
@@ -756,13 +2858,24 @@ private:
     }
 
     bool starts_with(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return (a_str == std::basic_string<charT>(m_str, a_str.size()));
+        return starts_with(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
     }
 
     bool starts_with(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
         return details::starts_with(m_str, a_str.c_str(), m_size, a_str.size());
     }
 
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr bool starts_with(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? starts_with(a_str, RecursivePolicyEnabled()) : starts_with(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr bool starts_with(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? starts_with(a_str, a_len, RecursivePolicyEnabled()) : starts_with(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
 public:
     /// \defgroup starts_with
     /// @brief Check if this string has specified prefix.
@@ -793,12 +2906,7 @@ public:
     //@}
 private:
     bool ends_with(const charT* a_str, RecursivePolicyDisabled) const {
-        std::basic_string<charT> str(a_str);
-        if (str.size() > m_size)
-            return false;
-        if (!m_size)
-            return true;
-        return (std::basic_string<charT>(m_str, m_size).substr(m_size - str.size(), str.size()) == str);
+        return ends_with(a_str, std::char_traits<charT>::length(a_str), RecursivePolicyDisabled());
     }
 
     constexpr bool ends_with(const charT* a_str, RecursivePolicyEnabled) const {
@@ -806,12 +2914,7 @@ private:
     }
 
     bool ends_with(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        std::basic_string<charT> str(a_str, a_len);
-        if (str.size() > m_size)
-            return false;
-        if (!m_size)
-            return true;
-        return (std::basic_string<charT>(m_str, m_size).substr(m_size - str.size(), str.size()) == str);
+        return (a_len <= m_size) && (std::char_traits<charT>::compare(m_str + m_size - a_len, a_str, a_len) == 0);
     }
 
     constexpr bool ends_with(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
@@ -819,11 +2922,7 @@ private:
     }
 
     bool ends_with(const this_type &a_str, RecursivePolicyDisabled) const {
-        if (a_str.size() > m_size)
-            return false;
-        if (!m_size)
-            return true;
-        return (this->substr(m_size - a_str.size(), a_str.size()) == a_str);
+        return ends_with(a_str.m_str, a_str.m_size, RecursivePolicyDisabled());
     }
 
     constexpr bool ends_with(const this_type &a_str, RecursivePolicyEnabled) const {
@@ -831,17 +2930,24 @@ private:
     }
 
     bool ends_with(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        if (a_str.size() > m_size)
-            return false;
-        if (!m_size)
-            return true;
-        return (this->substr(m_size - a_str.size(), a_str.size()) == a_str);
+        return ends_with(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
     }
 
     bool ends_with(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
         return details::ends_with(m_str, a_str.c_str(), (ssize_t)m_size - 1, (ssize_t)a_str.size() - 1);
     }
 
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr bool ends_with(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? ends_with(a_str, RecursivePolicyEnabled()) : ends_with(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr bool ends_with(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? ends_with(a_str, a_len, RecursivePolicyEnabled()) : ends_with(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
 public:
     /// \defgroup ends_with
     /// @brief Check if this string has specified suffix.
@@ -873,7 +2979,7 @@ public:
 
 private:
     bool equals(const charT* a_str, RecursivePolicyDisabled) const {
-        return (details::no_inline<charT>::common_length(m_str, a_str, m_size, -1) == m_size) && (a_str[m_size] == '\0');
+        return equals(a_str, std::char_traits<charT>::length(a_str), RecursivePolicyDisabled());
     }
 
     constexpr bool equals(const charT* a_str, RecursivePolicyEnabled) const {
@@ -881,7 +2987,7 @@ private:
     }
 
     bool equals(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return (a_len != m_size)?false:(details::no_inline<charT>::common_length(m_str, a_str, m_size, m_size) == m_size);
+        return (a_len == m_size) && (std::char_traits<charT>::compare(m_str, a_str, m_size) == 0);
     }
 
     constexpr bool equals(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
@@ -889,7 +2995,7 @@ private:
     }
 
     bool equals(const this_type &a_str, RecursivePolicyDisabled) const {
-        return (a_str.m_size != m_size)?false:(details::no_inline<charT>::common_length(m_str, a_str.m_str, m_size, m_size) == m_size);
+        return equals(a_str.m_str, a_str.m_size, RecursivePolicyDisabled());
     }
 
     constexpr bool equals(const this_type &a_str, RecursivePolicyEnabled) const {
@@ -897,13 +3003,24 @@ private:
     }
 
     bool equals(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return (a_str.size() != m_size)?false:(details::no_inline<charT>::common_length(m_str, a_str.c_str(), m_size, m_size) == m_size);
+        return equals(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
     }
 
     bool equals(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
         return (a_str.size() != m_size)?false:details::starts_with(m_str, a_str.c_str(), m_size, m_size);
     }
 
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr bool equals(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? equals(a_str, RecursivePolicyEnabled()) : equals(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr bool equals(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? equals(a_str, a_len, RecursivePolicyEnabled()) : equals(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
 public:
     /// \defgroup equals
     /// @brief Check if this string has the same contents as a specified string.
@@ -935,8 +3052,7 @@ public:
 
 private:
     int compare(const charT* a_str, RecursivePolicyDisabled) const {
-        std::string s(m_str, m_size);
-        return s.compare(a_str);
+        return compare(a_str, std::char_traits<charT>::length(a_str), RecursivePolicyDisabled());
     }
 
     constexpr int compare(const charT* a_str, RecursivePolicyEnabled) const {
@@ -944,14 +3060,25 @@ private:
     }
 
     int compare(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        std::string s(m_str, m_size);
-        return s.compare(0, m_size, a_str, a_len);
+        const int res = details::rt::text_compare<charT>(m_str, m_size, a_str, a_len);
+        return (res < 0) ? -1 : (res > 0) ? 1 : 0;
     }
 
     constexpr int compare(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
         return details::compare(m_str, a_str, m_size, a_len);
     }
 
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr int compare(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? compare(a_str, RecursivePolicyEnabled()) : compare(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr int compare(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? compare(a_str, a_len, RecursivePolicyEnabled()) : compare(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
 public:
     /// \defgroup compare
     /// @brief Compare two strings: this string and provided parameter string.
@@ -985,7 +3112,7 @@ public:
 
 private:
     bool contains(const charT* a_str, RecursivePolicyDisabled) const {
-        return (std::basic_string<charT>(m_str, m_size).find(a_str) != std::string::npos);
+        return details::rt::contains(m_str, a_str, m_size, details::no_inline<charT>::length(a_str));
     }
 
     constexpr bool contains(const charT* a_str, RecursivePolicyEnabled) const {
@@ -993,7 +3120,7 @@ private:
     }
 
     bool contains(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return (std::basic_string<charT>(m_str, m_size).find(a_str, 0, a_len) != std::string::npos);
+        return details::rt::contains(m_str, a_str, m_size, a_len);
     }
 
     constexpr bool contains(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
@@ -1001,7 +3128,7 @@ private:
     }
 
     bool contains(const this_type &a_str, RecursivePolicyDisabled) const {
-        return (std::basic_string<charT>(m_str, m_size).find(a_str.m_str, 0, a_str.m_size) != std::string::npos);
+        return details::rt::contains(m_str, a_str.m_str, m_size, a_str.m_size);
     }
 
     constexpr bool contains(const this_type &a_str, RecursivePolicyEnabled) const {
@@ -1009,13 +3136,24 @@ private:
     }
 
     bool contains(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return (std::basic_string<charT>(m_str, m_size).find(a_str) != std::string::npos);
+        return details::rt::contains(m_str, a_str.c_str(), m_size, a_str.size());
     }
 
     bool contains(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
-        return details::contains(m_str, a_str.c_str(), m_size, a_str.size());
+        return details::rt::contains(m_str, a_str.c_str(), m_size, a_str.size());
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr bool contains(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? contains(a_str, RecursivePolicyEnabled()) : contains(a_str, RecursivePolicyDisabled());
     }
 
+    constexpr bool contains(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? contains(a_str, a_len, RecursivePolicyEnabled()) : contains(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
 public:
     /// \defgroup contains
     /// @brief Check if this string contains character sequance equal to provided string.
@@ -1045,9 +3183,278 @@ public:
     }
     //@}
 
+    /// \defgroup contains_literal
+    /// @brief Check if this string contains string literal, see find_literal.
+    //@{
+    template<size_t N>
+    bool contains_literal(const charT (&a_str)[N]) const {
+        return (details::rt::fixed_index_of<N - 1>(m_str, m_size, a_str) >= 0);
+    }
+    //@}
+
+    /// \defgroup count
+    /// @brief Count occurrences of provided string in a single pass, without allocation.
+    /// @details For empty string returns number of positions inside this string (size + 1).
+    /// @param[in] a_mode selects if overlapping occurrences are counted
+    //@{
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    size_t count(const charT* a_str, size_t a_len, overlap_mode a_mode = overlap_mode::non_overlapping) const {
+        return details::rt::for_each_index_of(m_str, m_size, a_str, a_len, a_mode == overlap_mode::overlapping,
+            [](size_t) { return true; });
+    }
+
+    /// @brief overload for char_view
+    size_t count(const this_type &a_str, overlap_mode a_mode = overlap_mode::non_overlapping) const {
+        return count(a_str.m_str, a_str.m_size, a_mode);
+    }
+    //@}
+
+    /// \defgroup find_all
+    /// @brief Find positions of all occurrences of provided string in a single pass, without allocation.
+    /// @details For empty string all positions inside this string are reported (0..size).
+    /// @param[in] a_mode selects if overlapping occurrences are reported
+    //@{
+    /// @brief Writes positions of occurrences to output iterator, returns iterator after last written position.
+    /// @param[in] a_len number of characters inside a_str string
+    template<class OutputIt>
+    OutputIt find_all(const charT* a_str, size_t a_len, OutputIt a_out, overlap_mode a_mode = overlap_mode::non_overlapping) const {
+        details::rt::for_each_index_of(m_str, m_size, a_str, a_len, a_mode == overlap_mode::overlapping,
+            [&a_out](size_t pos) { *a_out++ = pos; return true; });
+        return a_out;
+    }
+
+    /// @brief overload for char_view
+    template<class OutputIt>
+    OutputIt find_all(const this_type &a_str, OutputIt a_out, overlap_mode a_mode = overlap_mode::non_overlapping) const {
+        return find_all(a_str.m_str, a_str.m_size, a_out, a_mode);
+    }
+
+    /// @brief Writes at most a_cap first positions to a_out buffer, returns number of written positions.
+    size_t find_all(const this_type &a_str, size_t *a_out, size_t a_cap, overlap_mode a_mode = overlap_mode::non_overlapping) const {
+        if (a_cap == 0)
+            return 0;
+        size_t written = 0;
+        details::rt::for_each_index_of(m_str, m_size, a_str.m_str, a_str.m_size, a_mode == overlap_mode::overlapping,
+            [=, &written](size_t pos) { a_out[written++] = pos; return written < a_cap; });
+        return written;
+    }
+    //@}
+
+private:
+    size_t ifind(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return details::rt::iindex_of(m_str, a_str, m_size, a_len);
+    }
+
+    constexpr size_t ifind(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return details::iindex_of(m_str, a_str, m_size, a_len);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    constexpr size_t ifind(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? ifind(a_str, a_len, RecursivePolicyEnabled()) : ifind(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup ifind
+    /// @brief Find position of provided string ignoring case of ASCII letters, see find.
+    /// @return returns position of first occurrence or npos if not found.
+    //@{
+    /// @brief Overload for zstring.
+    constexpr size_t ifind(const charT* a_str) const {
+        return ifind(a_str, length(a_str, typename RecursivePolicyTag<RecursivePolicy>::type()),
+                      typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr size_t ifind(const charT* a_str, size_t a_len) const {
+        return ifind(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr size_t ifind(const this_type &a_str) const {
+        return ifind(a_str.m_str, a_str.m_size, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    size_t ifind(const std::basic_string<charT> &a_str) const {
+        return ifind(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
+    }
+    //@}
+
+private:
+    bool icontains(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return (details::rt::iindex_of(m_str, a_str, m_size, a_len) >= 0);
+    }
+
+    constexpr bool icontains(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return (details::iindex_of(m_str, a_str, m_size, a_len) >= 0);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    constexpr bool icontains(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? icontains(a_str, a_len, RecursivePolicyEnabled()) : icontains(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup icontains
+    /// @brief Check if this string contains provided string ignoring case of ASCII letters, see contains.
+    //@{
+    /// @brief Overload for zstring.
+    constexpr bool icontains(const charT* a_str) const {
+        return icontains(a_str, length(a_str, typename RecursivePolicyTag<RecursivePolicy>::type()),
+                      typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr bool icontains(const charT* a_str, size_t a_len) const {
+        return icontains(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr bool icontains(const this_type &a_str) const {
+        return icontains(a_str.m_str, a_str.m_size, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    bool icontains(const std::basic_string<charT> &a_str) const {
+        return icontains(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
+    }
+    //@}
+
+private:
+    bool istarts_with(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return (a_len <= m_size) && details::rt::iequal_n(m_str, a_str, a_len);
+    }
+
+    constexpr bool istarts_with(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return (a_len <= m_size) && details::iequal_n(m_str, a_str, a_len);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    constexpr bool istarts_with(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? istarts_with(a_str, a_len, RecursivePolicyEnabled()) : istarts_with(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup istarts_with
+    /// @brief Check if this string has specified prefix ignoring case of ASCII letters, see starts_with.
+    //@{
+    /// @brief Overload for zstring.
+    constexpr bool istarts_with(const charT* a_str) const {
+        return istarts_with(a_str, length(a_str, typename RecursivePolicyTag<RecursivePolicy>::type()),
+                      typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr bool istarts_with(const charT* a_str, size_t a_len) const {
+        return istarts_with(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr bool istarts_with(const this_type &a_str) const {
+        return istarts_with(a_str.m_str, a_str.m_size, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    bool istarts_with(const std::basic_string<charT> &a_str) const {
+        return istarts_with(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
+    }
+    //@}
+
+private:
+    bool iends_with(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return (a_len <= m_size) && details::rt::iequal_n(m_str + m_size - a_len, a_str, a_len);
+    }
+
+    constexpr bool iends_with(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return (a_len <= m_size) && details::iequal_n(m_str + m_size - a_len, a_str, a_len);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    constexpr bool iends_with(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? iends_with(a_str, a_len, RecursivePolicyEnabled()) : iends_with(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup iends_with
+    /// @brief Check if this string has specified suffix ignoring case of ASCII letters, see ends_with.
+    //@{
+    /// @brief Overload for zstring.
+    constexpr bool iends_with(const charT* a_str) const {
+        return iends_with(a_str, length(a_str, typename RecursivePolicyTag<RecursivePolicy>::type()),
+                      typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr bool iends_with(const charT* a_str, size_t a_len) const {
+        return iends_with(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr bool iends_with(const this_type &a_str) const {
+        return iends_with(a_str.m_str, a_str.m_size, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    bool iends_with(const std::basic_string<charT> &a_str) const {
+        return iends_with(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
+    }
+    //@}
+
+private:
+    bool iequals(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return (a_len == m_size) && details::rt::iequal_n(m_str, a_str, a_len);
+    }
+
+    constexpr bool iequals(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return (a_len == m_size) && details::iequal_n(m_str, a_str, a_len);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    constexpr bool iequals(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? iequals(a_str, a_len, RecursivePolicyEnabled()) : iequals(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup iequals
+    /// @brief Check if this string has the same contents as a specified string ignoring case of ASCII letters, see equals.
+    //@{
+    /// @brief Overload for zstring.
+    constexpr bool iequals(const charT* a_str) const {
+        return iequals(a_str, length(a_str, typename RecursivePolicyTag<RecursivePolicy>::type()),
+                      typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr bool iequals(const charT* a_str, size_t a_len) const {
+        return iequals(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr bool iequals(const this_type &a_str) const {
+        return iequals(a_str.m_str, a_str.m_size, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    bool iequals(const std::basic_string<charT> &a_str) const {
+        return iequals(a_str.c_str(), a_str.size(), RecursivePolicyDisabled());
+    }
+    //@}
+
 private:
     size_t find(const charT* a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find(a_str);
+        return details::rt::index_of(m_str, a_str, m_size, details::no_inline<charT>::length(a_str));
     }
 
     constexpr size_t find(const charT* a_str, RecursivePolicyEnabled) const {
@@ -1055,7 +3462,7 @@ private:
     }
 
     size_t find(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find(a_str, 0, a_len);
+        return details::rt::index_of(m_str, a_str, m_size, a_len);
     }
 
     constexpr size_t find(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
@@ -1063,7 +3470,7 @@ private:
     }
 
     size_t find(const this_type &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find(a_str.m_str, 0, a_str.m_size);
+        return details::rt::index_of(m_str, a_str.m_str, m_size, a_str.m_size);
     }
 
     constexpr size_t find(const this_type &a_str, RecursivePolicyEnabled) const {
@@ -1071,12 +3478,23 @@ private:
     }
 
     size_t find(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find(a_str);
+        return details::rt::index_of(m_str, a_str.c_str(), m_size, a_str.size());
     }
 
     size_t find(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
-        return details::index_of(m_str, a_str.c_str(), m_size, a_str.size());
+        return details::rt::index_of(m_str, a_str.c_str(), m_size, a_str.size());
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr size_t find(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find(a_str, RecursivePolicyEnabled()) : find(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr size_t find(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find(a_str, a_len, RecursivePolicyEnabled()) : find(a_str, a_len, RecursivePolicyDisabled());
     }
+#endif
 
 public:
     /// \defgroup find
@@ -1107,9 +3525,22 @@ public:
     }
     //@}
 
+    /// \defgroup find_literal
+    /// @brief Find position of string literal inside this string, search code is specialized for literal length.
+    /// @details Runtime only. Needles up to 8 bytes are verified with a single word compare (e.g. 32-bit for "GET "),
+    /// longer ones are located with SIMD filter of first & last character.
+    /// @param[in] a_str string literal (or other array) to be found, last array element ('\0') is not searched.
+    /// @return returns position of a_str (zero-based) or basic_char_view::npos if not found.
+    //@{
+    template<size_t N>
+    size_t find_literal(const charT (&a_str)[N]) const {
+        return details::rt::fixed_index_of<N - 1>(m_str, m_size, a_str);
+    }
+    //@}
+
 private:
     size_t rfind(const charT* a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).rfind(a_str);
+        return details::rt::last_index_of(m_str, a_str, m_size, details::no_inline<charT>::length(a_str));
     }
 
     constexpr size_t rfind(const charT* a_str, RecursivePolicyEnabled) const {
@@ -1117,7 +3548,7 @@ private:
     }
 
     size_t rfind(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).rfind(a_str, 0, a_len);
+        return details::rt::last_index_of(m_str, a_str, m_size, a_len);
     }
 
     constexpr size_t rfind(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
@@ -1125,7 +3556,7 @@ private:
     }
 
     size_t rfind(const this_type &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).rfind(a_str.m_str, 0, a_str.m_size);
+        return details::rt::last_index_of(m_str, a_str.m_str, m_size, a_str.m_size);
     }
 
     constexpr size_t rfind(const this_type &a_str, RecursivePolicyEnabled) const {
@@ -1133,12 +3564,23 @@ private:
     }
 
     size_t rfind(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).rfind(a_str);
+        return details::rt::last_index_of(m_str, a_str.c_str(), m_size, a_str.size());
     }
 
     size_t rfind(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
-        return details::last_index_of(m_str, a_str.c_str(), m_size, a_str.size());
+        return details::rt::last_index_of(m_str, a_str.c_str(), m_size, a_str.size());
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr size_t rfind(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? rfind(a_str, RecursivePolicyEnabled()) : rfind(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr size_t rfind(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? rfind(a_str, a_len, RecursivePolicyEnabled()) : rfind(a_str, a_len, RecursivePolicyDisabled());
     }
+#endif
 
 public:
     /// \defgroup rfind
@@ -1167,260 +3609,1838 @@ public:
     size_t rfind(const std::basic_string<charT> &a_str) const {
         return rfind(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
     }
-    //@}
+    //@}
+
+private:
+    size_t find_first_of(const charT* a_str, RecursivePolicyDisabled) const {
+        return details::rt::index_of_any(m_str, make_char_set(a_str, details::no_inline<charT>::length(a_str)), m_size);
+    }
+
+    constexpr size_t find_first_of(const charT* a_str, RecursivePolicyEnabled) const {
+        return details::index_of_any(m_str, a_str, m_size, details::length(a_str));
+    }
+
+    size_t find_first_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return details::rt::index_of_any(m_str, make_char_set(a_str, a_len), m_size);
+    }
+
+    constexpr size_t find_first_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return details::index_of_any(m_str, a_str, m_size, a_len);
+    }
+
+    size_t find_first_of(const this_type &a_str, RecursivePolicyDisabled) const {
+        return details::rt::index_of_any(m_str, make_char_set(a_str.m_str, a_str.m_size), m_size);
+    }
+
+    constexpr size_t find_first_of(const this_type &a_str, RecursivePolicyEnabled) const {
+        return details::index_of_any(m_str, a_str.m_str, m_size, a_str.m_size);
+    }
+
+    size_t find_first_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
+        return details::rt::index_of_any(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+
+    size_t find_first_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
+        return details::rt::index_of_any(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+
+    size_t find_first_of(const basic_char_set<charT> &a_set, RecursivePolicyDisabled) const {
+        return details::rt::index_of_any(m_str, a_set, m_size);
+    }
+
+    constexpr size_t find_first_of(const basic_char_set<charT> &a_set, RecursivePolicyEnabled) const {
+        return details::index_of_any(m_str, a_set, m_size);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr size_t find_first_of(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_first_of(a_str, RecursivePolicyEnabled()) : find_first_of(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr size_t find_first_of(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_first_of(a_str, a_len, RecursivePolicyEnabled()) : find_first_of(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup find_first_of
+    /// @brief Find position of first character in this string which is included in provided character set.
+    /// @param[in] a_str character set
+    /// @return returns position of first matching character inside this string (zero-based) or basic_char_view::npos if not found.
+    //@{
+    /// @brief Find position of first character in this string which is included in provided character set.
+    /// @details Overload for zstring.
+    constexpr size_t find_first_of(const charT* a_str) const {
+        return find_first_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr size_t find_first_of_cn(const charT* a_str, size_t a_len) const {
+        return find_first_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr size_t find_first_of(const this_type &a_str) const {
+        return find_first_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    size_t find_first_of(const std::basic_string<charT> &a_str) const {
+        return find_first_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character set
+    constexpr size_t find_first_of(const basic_char_set<charT> &a_set) const {
+        return find_first_of(a_set, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+    //@}
+
+private:
+    size_t find_first_not_of(const charT* a_str, RecursivePolicyDisabled) const {
+        return details::rt::index_of_nonmatching(m_str, make_char_set(a_str, details::no_inline<charT>::length(a_str)), m_size);
+    }
+
+    constexpr size_t find_first_not_of(const charT* a_str, RecursivePolicyEnabled) const {
+        return details::index_of_nonmatching(m_str, a_str, m_size, details::length(a_str));
+    }
+
+    size_t find_first_not_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return details::rt::index_of_nonmatching(m_str, make_char_set(a_str, a_len), m_size);
+    }
+
+    constexpr size_t find_first_not_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return details::index_of_nonmatching(m_str, a_str, m_size, a_len);
+    }
+
+    size_t find_first_not_of(const this_type &a_str, RecursivePolicyDisabled) const {
+        return details::rt::index_of_nonmatching(m_str, make_char_set(a_str.m_str, a_str.m_size), m_size);
+    }
+
+    constexpr size_t find_first_not_of(const this_type &a_str, RecursivePolicyEnabled) const {
+        return details::index_of_nonmatching(m_str, a_str.m_str, m_size, a_str.size());
+    }
+
+    size_t find_first_not_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
+        return details::rt::index_of_nonmatching(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+
+    size_t find_first_not_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
+        return details::rt::index_of_nonmatching(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+
+    size_t find_first_not_of(const basic_char_set<charT> &a_set, RecursivePolicyDisabled) const {
+        return details::rt::index_of_nonmatching(m_str, a_set, m_size);
+    }
+
+    constexpr size_t find_first_not_of(const basic_char_set<charT> &a_set, RecursivePolicyEnabled) const {
+        return details::index_of_nonmatching(m_str, a_set, m_size);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr size_t find_first_not_of(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_first_not_of(a_str, RecursivePolicyEnabled()) : find_first_not_of(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr size_t find_first_not_of(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_first_not_of(a_str, a_len, RecursivePolicyEnabled()) : find_first_not_of(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup find_first_not_of
+    /// @brief Find position of first character in this string which is NOT included in provided character set.
+    /// @param[in] a_str character set
+    /// @return returns position of first non-matching character inside this string (zero-based) or basic_char_view::npos if not found.
+    //@{
+    /// @brief Find position of first character in this string which is NOT included in provided character set.
+    /// @details Overload for zstring.
+    constexpr size_t find_first_not_of(const charT* a_str) const {
+        return find_first_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr size_t find_first_not_of_cn(const charT* a_str, size_t a_len) const {
+        return find_first_not_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr size_t find_first_not_of(const this_type &a_str) const {
+        return find_first_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    size_t find_first_not_of(const std::basic_string<charT> &a_str) const {
+        return find_first_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character set
+    constexpr size_t find_first_not_of(const basic_char_set<charT> &a_set) const {
+        return find_first_not_of(a_set, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+    //@}
+
+private:
+    size_t find_last_of(const charT* a_str, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_any(m_str, make_char_set(a_str, details::no_inline<charT>::length(a_str)), m_size);
+    }
+
+    constexpr size_t find_last_of(const charT* a_str, RecursivePolicyEnabled) const {
+        return details::last_index_of_any(m_str, a_str, m_size, details::length(a_str));
+    }
+
+    size_t find_last_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_any(m_str, make_char_set(a_str, a_len), m_size);
+    }
+
+    constexpr size_t find_last_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return details::last_index_of_any(m_str, a_str, m_size, a_len);
+    }
+
+    size_t find_last_of(const this_type &a_str, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_any(m_str, make_char_set(a_str.m_str, a_str.m_size), m_size);
+    }
+
+    constexpr size_t find_last_of(const this_type &a_str, RecursivePolicyEnabled) const {
+        return details::last_index_of_any(m_str, a_str.m_str, m_size, a_str.m_size);
+    }
+
+    size_t find_last_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_any(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+
+    size_t find_last_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
+        return details::rt::last_index_of_any(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+    size_t find_last_of(const basic_char_set<charT> &a_set, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_any(m_str, a_set, m_size);
+    }
+
+    constexpr size_t find_last_of(const basic_char_set<charT> &a_set, RecursivePolicyEnabled) const {
+        return details::last_index_of_any(m_str, a_set, m_size);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr size_t find_last_of(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_last_of(a_str, RecursivePolicyEnabled()) : find_last_of(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr size_t find_last_of(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_last_of(a_str, a_len, RecursivePolicyEnabled()) : find_last_of(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup find_last_of
+    /// @brief Find last position of character in this string which is included in provided character set.
+    /// @param[in] a_str character set
+    /// @return returns position of last matching character inside this string (zero-based) or basic_char_view::npos if not found.
+    //@{
+    /// @brief Find last position of character in this string which is included in provided character set.
+    /// @details Overload for zstring.
+    constexpr size_t find_last_of(const charT* a_str) const {
+        return find_last_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr size_t find_last_of_cn(const charT* a_str, size_t a_len) const {
+        return find_last_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr size_t find_last_of(const this_type &a_str) const {
+        return find_last_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    size_t find_last_of(const std::basic_string<charT> &a_str) const {
+        return find_last_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character set
+    constexpr size_t find_last_of(const basic_char_set<charT> &a_set) const {
+        return find_last_of(a_set, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+    //@}
+
+private:
+    size_t find_last_not_of(const charT* a_str, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_nonmatching(m_str, make_char_set(a_str, details::no_inline<charT>::length(a_str)), m_size);
+    }
+
+    constexpr size_t find_last_not_of(const charT* a_str, RecursivePolicyEnabled) const {
+        return details::last_index_of_nonmatching(m_str, a_str, m_size, length(a_str, RecursivePolicyEnabled()));
+    }
+
+    size_t find_last_not_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_nonmatching(m_str, make_char_set(a_str, a_len), m_size);
+    }
+
+    constexpr size_t find_last_not_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
+        return details::last_index_of_nonmatching(m_str, a_str, m_size, a_len);
+    }
+
+    size_t find_last_not_of(const this_type &a_str, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_nonmatching(m_str, make_char_set(a_str.m_str, a_str.m_size), m_size);
+    }
+
+    constexpr size_t find_last_not_of(const this_type &a_str, RecursivePolicyEnabled) const {
+        return details::last_index_of_nonmatching(m_str, a_str.m_str, m_size, a_str.m_size);
+    }
+
+    size_t find_last_not_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_nonmatching(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+
+    size_t find_last_not_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
+        return details::rt::last_index_of_nonmatching(m_str, make_char_set(a_str.c_str(), a_str.size()), m_size);
+    }
+
+    size_t find_last_not_of(const basic_char_set<charT> &a_set, RecursivePolicyDisabled) const {
+        return details::rt::last_index_of_nonmatching(m_str, a_set, m_size);
+    }
+
+    constexpr size_t find_last_not_of(const basic_char_set<charT> &a_set, RecursivePolicyEnabled) const {
+        return details::last_index_of_nonmatching(m_str, a_set, m_size);
+    }
+
+#ifdef CV_HAS_CONSTANT_EVALUATED
+    template<class Text>
+    constexpr size_t find_last_not_of(const Text &a_str, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_last_not_of(a_str, RecursivePolicyEnabled()) : find_last_not_of(a_str, RecursivePolicyDisabled());
+    }
+
+    constexpr size_t find_last_not_of(const charT* a_str, size_t a_len, RecursivePolicyAuto) const {
+        return CV_IS_CONSTANT_EVALUATED() ? find_last_not_of(a_str, a_len, RecursivePolicyEnabled()) : find_last_not_of(a_str, a_len, RecursivePolicyDisabled());
+    }
+#endif
+
+public:
+    /// \defgroup find_last_not_of
+    /// @brief Find last position of character in this string which is NOT included in provided character set.
+    /// @param[in] a_str character set
+    /// @return returns position of last non-matching character inside this string (zero-based) or basic_char_view::npos if not found.
+    //@{
+    /// @brief Find last position of character in this string which is NOT included in provided character set.
+    /// @details Overload for zstring.
+    constexpr size_t find_last_not_of(const charT* a_str) const {
+        return find_last_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    constexpr size_t find_last_not_of_cn(const charT* a_str, size_t a_len) const {
+        return find_last_not_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for char_view
+    constexpr size_t find_last_not_of(const this_type &a_str) const {
+        return find_last_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for standard string
+    size_t find_last_not_of(const std::basic_string<charT> &a_str) const {
+        return find_last_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+
+    /// @brief overload for character set
+    constexpr size_t find_last_not_of(const basic_char_set<charT> &a_set) const {
+        return find_last_not_of(a_set, typename RecursivePolicyTag<RecursivePolicy>::type());
+    }
+    //@}
+};
+
+typedef basic_char_view<char> char_view;
+typedef basic_char_view<wchar_t> wchar_view;
+typedef basic_char_view<char16_t> char16_view;
+typedef basic_char_view<char32_t> char32_view;
+
+/// view with hash seeded per process, for hash containers with keys from untrusted input
+template<class charT>
+using basic_seeded_char_view = basic_char_view<charT, RecursivePolicyDisabled, default_range_check_policy,
+                                               default_error_policy<charT>, HashPolicySeeded>;
+
+typedef basic_seeded_char_view<char> seeded_char_view;
+typedef basic_seeded_char_view<wchar_t> seeded_wchar_view;
+typedef basic_seeded_char_view<char16_t> seeded_char16_view;
+typedef basic_seeded_char_view<char32_t> seeded_char32_view;
+
+/**
+  * @brief View which stores hash_code calculated once, during construction.
+  * @details For keys hashed and compared many times (hash containers, rehashing, joins).
+  * Equality compares hashes first, so most of unequal keys are rejected without reading characters.
+  * Implicitly constructible from basic_char_view with the same HashPolicy.
+  */
+template<class charT, typename HashPolicy = default_hash_policy>
+class basic_hashed_char_view
+{
+    const charT* m_str;
+    size_t m_size;
+    unsigned long long m_hash;
+
+public:
+    typedef charT value_type;
+    typedef const charT *const_iterator;
+    typedef basic_hashed_char_view<charT, HashPolicy> this_type;
+    typedef basic_char_view<charT, default_recursive_policy, default_range_check_policy,
+                            default_error_policy<charT>, HashPolicy> view_type;
+
+    /// creates view with hash calculated by source view (in compile time if possible)
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy>
+    constexpr basic_hashed_char_view(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str):
+        m_str(a_str.data()), m_size(a_str.size()), m_hash(a_str.hash_code())
+    {
+    }
+
+    /// creates view with already known hash_code, e.g. from hash_batch
+    constexpr basic_hashed_char_view(const charT* a_str, size_t a_len, unsigned long long a_hash):
+        m_str(a_str), m_size(a_len), m_hash(a_hash)
+    {
+    }
+
+    basic_hashed_char_view(const charT* a_str, size_t a_len):
+        m_str(a_str), m_size(a_len), m_hash(HashPolicy::hash_chars(a_str, a_len, RecursivePolicyDisabled()))
+    {
+    }
+
+    basic_hashed_char_view(const std::basic_string<charT> &a_str):
+        basic_hashed_char_view(a_str.c_str(), a_str.size())
+    {
+    }
+
+    constexpr const charT* data() const noexcept { return m_str; }
+    constexpr size_t size() const noexcept { return m_size; }
+    constexpr size_t length() const noexcept { return m_size; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr const_iterator cbegin() const { return m_str; }
+    constexpr const_iterator cend() const { return m_str + m_size; }
+
+    /// returns stored hash value
+    constexpr unsigned long long hash_code() const noexcept { return m_hash; }
+
+    /// returns view of the same characters
+    constexpr view_type view() const { return view_type(m_str, m_size); }
+
+    /// converts to standard string
+    explicit operator std::basic_string<charT>() const {
+        return std::basic_string<charT>(m_str, m_size);
+    }
+
+    /// compares hashes & sizes first, characters only if both are equal
+    bool equals(const this_type &a_str) const {
+        return (m_hash == a_str.m_hash) && (m_size == a_str.m_size) &&
+               (std::char_traits<charT>::compare(m_str, a_str.m_str, m_size) == 0);
+    }
+
+    friend bool operator==(const this_type &ltr, const this_type &rtr) { return ltr.equals(rtr); }
+    friend bool operator!=(const this_type &ltr, const this_type &rtr) { return !ltr.equals(rtr); }
+};
+
+typedef basic_hashed_char_view<char> hashed_char_view;
+typedef basic_hashed_char_view<wchar_t> hashed_wchar_view;
+typedef basic_hashed_char_view<char16_t> hashed_char16_view;
+typedef basic_hashed_char_view<char32_t> hashed_char32_view;
+
+/**
+  * @brief String of N characters stored by value (with '\0' appended), literal & structural type.
+  * @details Unlike basic_char_view it does not point to external characters, so with C++20 it can be used
+  * as non-type template argument - functions called on it in template code are evaluated in compile time:
+  *
+  *     template<basic_fixed_string Route> struct handler {
+  *         static constexpr unsigned long long id = Route.hash_code();
+  *         static constexpr bool is_api = Route.starts_with("/api/");
+  *     };
+  *     handler<"/api/users"> users;
+  *
+  * Read-only functions of basic_char_view are available directly and return the same values,
+  * view() returns view of stored characters without copying. Views returned by substr, trim etc.
+  * point into this object. Construction in compile time requires C++14.
+  * Template parameter must be declared with basic_fixed_string, fixed_string<N> aliases do not deduce N from literal.
+  */
+template<class charT, size_t N>
+class basic_fixed_string
+{
+public:
+    typedef charT value_type;
+    typedef const charT *const_iterator;
+    typedef basic_fixed_string<charT, N> this_type;
+    typedef basic_char_view<charT> view_type;
+
+    /// null position (undefined)
+    static constexpr size_t npos = view_type::npos;
+
+    /// characters, public as required for structural type - use data() or view() instead
+    charT m_data[N + 1];
+
+    /// creates string from string literal (or other array) of N characters and '\0'
+    CV_CONSTEXPR14 basic_fixed_string(const charT (&a_str)[N + 1]): m_data() {
+        for(size_t i = 0; i < N; ++i)
+            m_data[i] = a_str[i];
+    }
+
+    constexpr const charT* data() const noexcept { return m_data; }
+    constexpr const charT* c_str() const noexcept { return m_data; }
+    constexpr size_t size() const noexcept { return N; }
+    constexpr size_t length() const noexcept { return N; }
+    constexpr bool empty() const noexcept { return N == 0; }
+    constexpr const_iterator begin() const { return m_data; }
+    constexpr const_iterator end() const { return m_data + N; }
+    constexpr const_iterator cbegin() const { return m_data; }
+    constexpr const_iterator cend() const { return m_data + N; }
+
+    /// returns view of stored characters
+    constexpr view_type view() const noexcept { return view_type(m_data, N); }
+
+    constexpr operator view_type() const noexcept { return view(); }
+
+    /// converts to standard string
+    explicit operator std::basic_string<charT>() const {
+        return std::basic_string<charT>(m_data, N);
+    }
+
+    /// returns character at a given position, fails if out of bounds
+    constexpr charT operator[](size_t index) const { return view()[index]; }
+
+    constexpr unsigned long long hash_code() const { return view().hash_code(); }
+    constexpr unsigned long long ihash_code() const { return view().ihash_code(); }
+
+// forwards read-only function of basic_char_view (all overloads)
+#define CV_FIXED_STRING_FORWARD(name) \
+    template<class... Args> \
+    constexpr auto name(const Args&... a_args) const -> decltype(std::declval<const view_type&>().name(a_args...)) { \
+        return view().name(a_args...); \
+    }
+
+    CV_FIXED_STRING_FORWARD(at)
+    CV_FIXED_STRING_FORWARD(front)
+    CV_FIXED_STRING_FORWARD(back)
+    CV_FIXED_STRING_FORWARD(substr)
+    CV_FIXED_STRING_FORWARD(trim)
+    CV_FIXED_STRING_FORWARD(trim_left)
+    CV_FIXED_STRING_FORWARD(trim_right)
+    CV_FIXED_STRING_FORWARD(starts_with)
+    CV_FIXED_STRING_FORWARD(ends_with)
+    CV_FIXED_STRING_FORWARD(equals)
+    CV_FIXED_STRING_FORWARD(compare)
+    CV_FIXED_STRING_FORWARD(contains)
+    CV_FIXED_STRING_FORWARD(contains_literal)
+    CV_FIXED_STRING_FORWARD(find)
+    CV_FIXED_STRING_FORWARD(find_cn)
+    CV_FIXED_STRING_FORWARD(find_literal)
+    CV_FIXED_STRING_FORWARD(rfind)
+    CV_FIXED_STRING_FORWARD(rfind_cn)
+    CV_FIXED_STRING_FORWARD(find_first_of)
+    CV_FIXED_STRING_FORWARD(find_first_of_cn)
+    CV_FIXED_STRING_FORWARD(find_first_not_of)
+    CV_FIXED_STRING_FORWARD(find_first_not_of_cn)
+    CV_FIXED_STRING_FORWARD(find_last_of)
+    CV_FIXED_STRING_FORWARD(find_last_of_cn)
+    CV_FIXED_STRING_FORWARD(find_last_not_of)
+    CV_FIXED_STRING_FORWARD(find_last_not_of_cn)
+    CV_FIXED_STRING_FORWARD(count)
+    CV_FIXED_STRING_FORWARD(find_all)
+    CV_FIXED_STRING_FORWARD(ifind)
+    CV_FIXED_STRING_FORWARD(icontains)
+    CV_FIXED_STRING_FORWARD(istarts_with)
+    CV_FIXED_STRING_FORWARD(iends_with)
+    CV_FIXED_STRING_FORWARD(iequals)
+
+#undef CV_FIXED_STRING_FORWARD
+
+    template<size_t M>
+    friend constexpr bool operator==(const this_type &ltr, const basic_fixed_string<charT, M> &rtr) { return ltr.view().equals(rtr.view()); }
+    template<size_t M>
+    friend constexpr bool operator!=(const this_type &ltr, const basic_fixed_string<charT, M> &rtr) { return !ltr.view().equals(rtr.view()); }
+    friend constexpr bool operator==(const this_type &ltr, const view_type &rtr) { return ltr.view().equals(rtr); }
+    friend constexpr bool operator!=(const this_type &ltr, const view_type &rtr) { return !ltr.view().equals(rtr); }
+    friend constexpr bool operator==(const view_type &ltr, const this_type &rtr) { return rtr.view().equals(ltr); }
+    friend constexpr bool operator!=(const view_type &ltr, const this_type &rtr) { return !rtr.view().equals(ltr); }
+};
+
+template<class charT, size_t N>
+constexpr size_t basic_fixed_string<charT, N>::npos;
+
+#ifdef __cpp_deduction_guides
+template<class charT, size_t N>
+basic_fixed_string(const charT (&)[N]) -> basic_fixed_string<charT, N - 1>;
+#endif
+
+template<size_t N> using fixed_string = basic_fixed_string<char, N>;
+template<size_t N> using fixed_wstring = basic_fixed_string<wchar_t, N>;
+template<size_t N> using fixed_u16string = basic_fixed_string<char16_t, N>;
+template<size_t N> using fixed_u32string = basic_fixed_string<char32_t, N>;
+
+/**
+  * @brief Transparent hash function for views, standard strings (and std::basic_string_view), zstrings.
+  * @details Returns equal values for equal texts of any of these types, so containers keyed by std::string
+  * can be searched with char_view without temporary string (heterogeneous lookup, C++20 for unordered containers):
+  *
+  *     std::unordered_map<std::string, int, char_view_hash, char_view_equal> map;
+  *     map.find("key"_cv);
+  */
+template<class charT, typename HashPolicy = default_hash_policy>
+struct basic_char_view_hash
+{
+    typedef void is_transparent;
+
+    template<class Text>
+    size_t operator()(const Text &a_str) const {
+        return static_cast<size_t>(HashPolicy::hash_chars(details::rt::text_data(a_str), details::rt::text_size(a_str),
+                                                          RecursivePolicyDisabled()));
+    }
+
+    /// overload for hashed view: returns stored hash
+    size_t operator()(const basic_hashed_char_view<charT, HashPolicy> &a_str) const {
+        return static_cast<size_t>(a_str.hash_code());
+    }
+};
+
+/// Transparent equality for views, standard strings, zstrings
+template<class charT>
+struct basic_char_view_equal
+{
+    typedef void is_transparent;
+
+    template<class Text1, class Text2>
+    bool operator()(const Text1 &a_str1, const Text2 &a_str2) const {
+        const size_t len = details::rt::text_size(a_str1);
+        return (len == static_cast<size_t>(details::rt::text_size(a_str2))) &&
+               (std::char_traits<charT>::compare(details::rt::text_data(a_str1), details::rt::text_data(a_str2), len) == 0);
+    }
+};
+
+/// Transparent ordering for views, standard strings, zstrings (for ordered containers, e.g. std::map::find)
+template<class charT>
+struct basic_char_view_less
+{
+    typedef void is_transparent;
+
+    template<class Text1, class Text2>
+    bool operator()(const Text1 &a_str1, const Text2 &a_str2) const {
+        return details::rt::text_compare<charT>(details::rt::text_data(a_str1), details::rt::text_size(a_str1),
+                                                details::rt::text_data(a_str2), details::rt::text_size(a_str2)) < 0;
+    }
+};
+
+typedef basic_char_view_hash<char> char_view_hash;
+typedef basic_char_view_hash<wchar_t> wchar_view_hash;
+typedef basic_char_view_hash<char16_t> char16_view_hash;
+typedef basic_char_view_hash<char32_t> char32_view_hash;
+
+typedef basic_char_view_equal<char> char_view_equal;
+typedef basic_char_view_equal<wchar_t> wchar_view_equal;
+typedef basic_char_view_equal<char16_t> char16_view_equal;
+typedef basic_char_view_equal<char32_t> char32_view_equal;
+
+typedef basic_char_view_less<char> char_view_less;
+typedef basic_char_view_less<wchar_t> wchar_view_less;
+typedef basic_char_view_less<char16_t> char16_view_less;
+typedef basic_char_view_less<char32_t> char32_view_less;
+
+/**
+  * @brief Transparent case-insensitive hash function (ASCII letters), to be used together with basic_char_view_iequal.
+  * @details Returns ihash_code of text, e.g.:
+  *
+  *     std::unordered_map<std::string, int, char_view_ihash, char_view_iequal> headers;
+  *     headers.find("content-type"_cv); // finds "Content-Type"
+  */
+template<class charT, typename HashPolicy = default_hash_policy>
+struct basic_char_view_ihash
+{
+    typedef void is_transparent;
+
+    template<class Text>
+    size_t operator()(const Text &a_str) const {
+        return static_cast<size_t>(HashPolicy::ihash_chars(details::rt::text_data(a_str), details::rt::text_size(a_str),
+                                                           RecursivePolicyDisabled()));
+    }
+};
+
+/// Transparent case-insensitive equality (ASCII letters) for views, standard strings, zstrings
+template<class charT>
+struct basic_char_view_iequal
+{
+    typedef void is_transparent;
+
+    template<class Text1, class Text2>
+    bool operator()(const Text1 &a_str1, const Text2 &a_str2) const {
+        const size_t len = details::rt::text_size(a_str1);
+        return (len == static_cast<size_t>(details::rt::text_size(a_str2))) &&
+               details::rt::iequal_n(static_cast<const charT*>(details::rt::text_data(a_str1)),
+                                     static_cast<const charT*>(details::rt::text_data(a_str2)), len);
+    }
+};
+
+typedef basic_char_view_ihash<char> char_view_ihash;
+typedef basic_char_view_ihash<wchar_t> wchar_view_ihash;
+typedef basic_char_view_ihash<char16_t> char16_view_ihash;
+typedef basic_char_view_ihash<char32_t> char32_view_ihash;
+
+typedef basic_char_view_iequal<char> char_view_iequal;
+typedef basic_char_view_iequal<wchar_t> wchar_view_iequal;
+typedef basic_char_view_iequal<char16_t> char16_view_iequal;
+typedef basic_char_view_iequal<char32_t> char32_view_iequal;
+
+/**
+  * @brief Incremental hasher: hash of text received in fragments, without joining them.
+  * @details finish() returns value equal to hash_code() of view of all characters passed to update()
+  * (with the same HashPolicy):
+  *
+  *     char_view_hasher hasher;
+  *     while (read(buffer, &len))
+  *         hasher.update(buffer, len);
+  *     auto hash = hasher.finish();
+  *
+  * Hash is calculated forwards in 48-byte blocks, only the last 64 bytes are kept in hasher.
+  */
+template<class charT, typename HashPolicy = default_hash_policy>
+class basic_char_view_hasher
+{
+    // unprocessed bytes are kept after 16 bytes of history (end of last processed block), needed by final step
+    enum { history_size = 16, block_size = 48 };
+
+    unsigned char m_data[history_size + block_size];
+    size_t m_buffered;
+    unsigned long long m_length;
+    unsigned long long m_seed;
+    unsigned long long m_see1;
+    unsigned long long m_see2;
+
+    void append(const unsigned char* a_bytes, size_t a_len) {
+        std::memcpy(m_data + history_size + m_buffered, a_bytes, a_len);
+        m_buffered += a_len;
+    }
+
+    void update_bytes(const unsigned char* a_bytes, size_t a_len) {
+        m_length += a_len;
+        // block can be hashed only if it is not the last one, so up to block_size bytes are buffered
+        if (m_buffered + a_len <= block_size) {
+            append(a_bytes, a_len);
+            return;
+        }
+
+        if (m_buffered > 0) {
+            const size_t fill = block_size - m_buffered;
+            append(a_bytes, fill);
+            a_bytes += fill;
+            a_len -= fill;
+            details::rt::hash_block48(m_data + history_size, m_seed, m_see1, m_see2, HashPolicy::hash_secrets());
+            std::memcpy(m_data, m_data + block_size, history_size);
+            m_buffered = 0;
+        }
+
+        if (a_len > block_size) {
+            do {
+                details::rt::hash_block48(a_bytes, m_seed, m_see1, m_see2, HashPolicy::hash_secrets());
+                a_bytes += block_size;
+                a_len -= block_size;
+            } while (a_len > block_size);
+            std::memcpy(m_data, a_bytes - history_size, history_size);
+        }
+        append(a_bytes, a_len);
+    }
+
+public:
+    typedef basic_char_view_hasher<charT, HashPolicy> this_type;
+
+    /// creates hasher using seed of HashPolicy
+    basic_char_view_hasher() {
+        reset();
+    }
+
+    /// starts new hash
+    void reset() {
+        const unsigned long long seed = HashPolicy::hash_seed();
+        m_buffered = 0;
+        m_length = 0;
+        m_seed = m_see1 = m_see2 = seed ^ details::rt::hash_mix(seed ^ HashPolicy::hash_secrets().secret0, HashPolicy::hash_secrets().secret1);
+    }
+
+    /// appends a_len characters to hashed text
+    void update(const charT* a_str, size_t a_len) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        // hash is defined on little-endian bytes
+        unsigned char bytes[block_size];
+        size_t count = 0;
+        for(size_t i = 0; i < a_len * sizeof(charT); ++i) {
+            bytes[count++] = static_cast<unsigned char>(details::hash_byte<false>(a_str, i));
+            if (count == block_size) {
+                update_bytes(bytes, count);
+                count = 0;
+            }
+        }
+        update_bytes(bytes, count);
+#else
+        update_bytes(reinterpret_cast<const unsigned char *>(a_str), a_len * sizeof(charT));
+#endif
+    }
+
+    /// overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename ViewHashPolicy>
+    void update(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, ViewHashPolicy> &a_str) {
+        update(a_str.data(), a_str.size());
+    }
+
+    /// overload for standard string
+    void update(const std::basic_string<charT> &a_str) {
+        update(a_str.data(), a_str.size());
+    }
+
+    /// returns number of characters hashed so far
+    size_t size() const {
+        return static_cast<size_t>(m_length / sizeof(charT));
+    }
+
+    /// @brief returns hash of all characters passed to update, equal to hash_code() of their concatenation
+    /// @details Hasher is not modified, so update can be continued.
+    unsigned long long finish() const {
+        const unsigned char *pos = m_data + history_size;
+        const size_t len = static_cast<size_t>(m_length);
+        if (len <= 16) {
+            unsigned long long a, b;
+            details::rt::hash_short_words(pos, len, a, b);
+            return details::rt::hash_final(a, b, m_seed, len, HashPolicy::hash_secrets());
+        }
+        return details::rt::hash_tail16(pos, m_buffered, (len > block_size) ? (m_seed ^ m_see1 ^ m_see2) : m_seed, len,
+                                        HashPolicy::hash_secrets());
+    }
+};
+
+typedef basic_char_view_hasher<char> char_view_hasher;
+typedef basic_char_view_hasher<wchar_t> wchar_view_hasher;
+typedef basic_char_view_hasher<char16_t> char16_view_hasher;
+typedef basic_char_view_hasher<char32_t> char32_view_hasher;
+
+/**
+  * @brief Precompiled searcher for a single needle, to be reused for many haystacks.
+  * Needle is analyzed once during construction, search algorithm is selected by needle length:
+  * character scan for single characters, Boyer-Moore-Horspool for short needles and Two-Way
+  * for long ones (linear in worst case).
+  *
+  * Searcher does not copy needle characters - needle buffer must outlive the searcher.
+  * Object is immutable after construction, so it can be copied and shared between threads.
+  */
+template<class charT>
+class basic_char_view_searcher
+{
+    const charT* m_needle;
+    size_t m_size;
+    details::rt::search_plan<charT> m_forward;
+    details::rt::search_plan<charT> m_backward;
+
+    details::rt::forward_seq<charT> needle_seq() const {
+        details::rt::forward_seq<charT> res = { m_needle };
+        return res;
+    }
+
+    details::rt::reverse_seq<charT> needle_rev_seq() const {
+        details::rt::reverse_seq<charT> res = { m_needle + m_size - 1 };
+        return res;
+    }
+
+    void build() {
+        m_forward.build(needle_seq(), m_size);
+        if (m_size > 0)
+            m_backward.build(needle_rev_seq(), m_size);
+        else
+            m_backward.build(needle_seq(), m_size);
+    }
+
+public:
+    typedef basic_char_view_searcher<charT> this_type;
+
+    /// null position (undefined)
+    static const size_t npos = -1;
+
+    /// @brief Constructs searcher for character buffer
+    /// @param[in] a_str needle characters, not required to end with '\0'
+    /// @param[in] a_len number of characters inside a_str string
+    basic_char_view_searcher(const charT* a_str, size_t a_len): m_needle(a_str), m_size(a_len) {
+        build();
+    }
+
+    /// @brief Constructs searcher for char_view needle
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    explicit basic_char_view_searcher(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_needle):
+        m_needle(a_needle.data()), m_size(a_needle.size())
+    {
+        build();
+    }
+
+    /// returns needle size
+    size_t size() const { return m_size; }
+
+    /// \defgroup searcher_find
+    /// @brief Find first position of needle inside provided haystack.
+    /// @return returns position of needle (zero-based) or npos if not found.
+    //@{
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    size_t find(const charT* a_str, size_t a_len) const {
+        const details::rt::forward_seq<charT> haystack = { a_str };
+        return m_forward.find(haystack, a_len, needle_seq(), m_size);
+    }
+
+    /// @brief overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    size_t find(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str) const {
+        return find(a_str.data(), a_str.size());
+    }
+    //@}
+
+    /// \defgroup searcher_rfind
+    /// @brief Find last position of needle inside provided haystack.
+    /// @return returns position of needle (zero-based) or npos if not found.
+    //@{
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    size_t rfind(const charT* a_str, size_t a_len) const {
+        if (m_size == 0)
+            return a_len;
+        if (m_size > a_len)
+            return npos;
+
+        const details::rt::reverse_seq<charT> haystack = { a_str + a_len - 1 };
+        const ssize_t res = m_backward.find(haystack, a_len, needle_rev_seq(), m_size);
+        return (res < 0) ? npos : a_len - m_size - res;
+    }
+
+    /// @brief overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    size_t rfind(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str) const {
+        return rfind(a_str.data(), a_str.size());
+    }
+    //@}
+
+    /// \defgroup searcher_count
+    /// @brief Count non-overlapping occurrences of needle inside provided haystack.
+    /// @details For empty needle returns number of positions inside haystack (size + 1).
+    //@{
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    size_t count(const charT* a_str, size_t a_len) const {
+        if (m_size == 0)
+            return a_len + 1;
+
+        size_t res = 0;
+        size_t pos = 0;
+        size_t found;
+        while ((found = find(a_str + pos, a_len - pos)) != npos) {
+            ++res;
+            pos += found + m_size;
+        }
+        return res;
+    }
+
+    /// @brief overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    size_t count(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str) const {
+        return count(a_str.data(), a_str.size());
+    }
+    //@}
+};
+
+typedef basic_char_view_searcher<char> char_view_searcher;
+typedef basic_char_view_searcher<wchar_t> wchar_view_searcher;
+typedef basic_char_view_searcher<char16_t> char16_view_searcher;
+typedef basic_char_view_searcher<char32_t> char32_view_searcher;
+
+namespace details
+{
+    // list of indexes 0..N-1 for pack expansion (C++11 replacement of std::index_sequence)
+    template<size_t... I>
+    struct index_list {};
+
+    template<size_t N, size_t... I>
+    struct make_index_list: make_index_list<N - 1, N - 1, I...> {};
+
+    template<size_t... I>
+    struct make_index_list<0, I...> {
+        typedef index_list<I...> type;
+    };
+
+    // Fixed-capacity array with std::vector-like interface, usable in constant expressions (C++14).
+    template<class T, size_t N>
+    class fixed_array {
+        T m_data[N] = {};
+        size_t m_size = 0;
+    public:
+        CV_CONSTEXPR14 void push_back(const T &value) {
+            if (m_size >= N)
+                throw std::length_error("ERROR: fixed_array - capacity exceeded");
+            m_data[m_size++] = value;
+        }
+
+        CV_CONSTEXPR14 void resize(size_t a_size, const T &value) {
+            if (a_size > N)
+                throw std::length_error("ERROR: fixed_array - capacity exceeded");
+            for(size_t i = m_size; i < a_size; ++i)
+                m_data[i] = value;
+            m_size = a_size;
+        }
+
+        constexpr size_t size() const { return m_size; }
+        CV_CONSTEXPR14 T &operator[](size_t index) { return m_data[index]; }
+        constexpr const T &operator[](size_t index) const { return m_data[index]; }
+    };
+
+    // Selects storage for tables: dynamic (std::vector) for N = 0, otherwise fixed_array<T, N>
+    template<class T, size_t N>
+    struct table_storage {
+        typedef fixed_array<T, N> type;
+    };
+
+    template<class T>
+    struct table_storage<T, 0> {
+        typedef std::vector<T> type;
+    };
+}
+
+/// Single match reported by multi-pattern matcher
+struct char_view_match {
+    /// position of match inside haystack (zero-based), npos if not found
+    size_t pos;
+    /// number of matching characters
+    size_t size;
+    /// index of matching pattern (position on pattern list)
+    size_t pattern_index;
+};
+
+/**
+  * @brief Multi-pattern matcher (Aho-Corasick automaton) for finding many patterns in a single pass.
+  * Automaton is flattened into DFA transition table, characters are mapped to classes first
+  * (one class for each distinct pattern character plus one for all other characters),
+  * so table row contains only as many entries as there are distinct pattern characters.
+  *
+  * Uses the following template arguments:
+  * - charT: character data type (char, wchar, char16_t etc)
+  * - MaxStates: maximum number of automaton states (total size of patterns + 1), 0 = dynamic storage
+  * - MaxClasses: maximum number of character classes (distinct pattern characters + 1), used with MaxStates > 0
+  *
+  * With fixed storage (MaxStates > 0) and C++14 the matcher can be constructed in compile time:
+  * \code{.cpp}
+  *    constexpr basic_char_view_matcher<char, 16> m = { "GET"_cv, "POST"_cv, "PUT"_cv };
+  * \endcode
+  *
+  * Empty patterns are ignored, duplicated patterns are reported with index of the first one.
+  * Pattern characters are not referenced after construction.
+  */
+template<class charT, size_t MaxStates = 0, size_t MaxClasses = MaxStates>
+class basic_char_view_matcher
+{
+    typedef unsigned int state_type;
+    typedef unsigned short class_type;
+    typedef typename std::make_unsigned<charT>::type uchar_type;
+
+    enum { narrow_class_count = 256 };
+    static constexpr state_type no_state = static_cast<state_type>(-1);
+
+    typedef typename details::table_storage<state_type, MaxStates * MaxClasses>::type delta_table;
+    typedef typename details::table_storage<state_type, MaxStates>::type state_table;
+    typedef typename details::table_storage<size_t, MaxStates>::type size_table;
+    typedef typename details::table_storage<charT, MaxClasses>::type char_table;
+    typedef typename details::table_storage<class_type, MaxClasses>::type class_table;
+
+    // class of characters with code < 256
+    class_type m_class[narrow_class_count] = {};
+    // sorted characters with code >= 256 and their classes
+    char_table m_wide_chars;
+    class_table m_wide_classes;
+    size_t m_class_count = 1;
+
+    // transitions: m_delta[state * m_class_count + class]
+    delta_table m_delta;
+    // failure links
+    state_table m_fail;
+    // index of pattern ending in state, no_state if none
+    state_table m_output;
+    // first state in failure chain (including state itself) with pattern ending, no_state if none
+    state_table m_report;
+    // size of each pattern, by pattern index
+    size_table m_pattern_size;
+
+public:
+    typedef basic_char_view_matcher<charT, MaxStates, MaxClasses> this_type;
+    typedef basic_char_view<charT> view_type;
+
+    /// null position (undefined)
+    static const size_t npos = -1;
+
+    /// @brief Constructs matcher for list of patterns
+    CV_CONSTEXPR14 basic_char_view_matcher(std::initializer_list<view_type> a_patterns) {
+        build(a_patterns.begin(), a_patterns.end());
+    }
+
+    /// @brief Constructs matcher for range of patterns (objects with data() & size())
+    template<class InputIt>
+    CV_CONSTEXPR14 basic_char_view_matcher(InputIt a_first, InputIt a_last) {
+        build(a_first, a_last);
+    }
+
+    /// returns number of patterns (including ignored empty ones)
+    constexpr size_t size() const { return m_pattern_size.size(); }
+
+    /// \defgroup matcher_find
+    /// @brief Find first match (ending first) inside haystack, for matches ending at the same position the longest one is returned.
+    /// @return returns match with pos = npos if nothing found.
+    //@{
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    CV_CONSTEXPR14 char_view_match find(const charT* a_str, size_t a_len) const {
+        state_type state = 0;
+        for(size_t i = 0; i < a_len; ++i) {
+            state = next_state(state, a_str[i]);
+            if (m_report[state] != no_state)
+                return make_match(i, m_report[state]);
+        }
+
+        char_view_match res = { npos, 0, npos };
+        return res;
+    }
+
+    /// @brief overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    CV_CONSTEXPR14 char_view_match find(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str) const {
+        return find(a_str.data(), a_str.size());
+    }
+    //@}
+
+    /// \defgroup matcher_find_all
+    /// @brief Reports all matches inside haystack (including overlapping ones), ordered by match end.
+    /// @param[out] a_out output iterator receiving char_view_match objects
+    /// @return returns output iterator after last written match.
+    //@{
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    template<class OutputIt>
+    OutputIt find_all(const charT* a_str, size_t a_len, OutputIt a_out) const {
+        state_type state = 0;
+        for(size_t i = 0; i < a_len; ++i) {
+            state = next_state(state, a_str[i]);
+            for(state_type found = m_report[state]; found != no_state; found = m_report[m_fail[found]]) {
+                *a_out = make_match(i, found);
+                ++a_out;
+            }
+        }
+        return a_out;
+    }
+
+    /// @brief overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy, class OutputIt>
+    OutputIt find_all(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str, OutputIt a_out) const {
+        return find_all(a_str.data(), a_str.size(), a_out);
+    }
+    //@}
+
+    /// \defgroup matcher_contains
+    /// @brief Check if haystack contains any of patterns.
+    //@{
+    /// @brief overload for character buffer
+    /// @param[in] a_len number of characters inside a_str string
+    CV_CONSTEXPR14 bool contains(const charT* a_str, size_t a_len) const {
+        return (find(a_str, a_len).pos != npos);
+    }
+
+    /// @brief overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    CV_CONSTEXPR14 bool contains(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str) const {
+        return contains(a_str.data(), a_str.size());
+    }
+    //@}
+
+private:
+    CV_CONSTEXPR14 char_view_match make_match(size_t end_pos, state_type state) const {
+        const size_t pattern_size = m_pattern_size[m_output[state]];
+        char_view_match res = { end_pos + 1 - pattern_size, pattern_size, m_output[state] };
+        return res;
+    }
+
+    CV_CONSTEXPR14 size_t find_wide_class(charT ch) const {
+        size_t lo = 0;
+        size_t hi = m_wide_chars.size();
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (m_wide_chars[mid] < ch)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return ((lo < m_wide_chars.size()) && (m_wide_chars[lo] == ch)) ? m_wide_classes[lo] : 0;
+    }
+
+    CV_CONSTEXPR14 size_t class_of(charT ch) const {
+        return (static_cast<uchar_type>(ch) < narrow_class_count) ?
+                   m_class[static_cast<uchar_type>(ch)] :
+                   find_wide_class(ch);
+    }
+
+    CV_CONSTEXPR14 state_type next_state(state_type state, charT ch) const {
+        return m_delta[state * m_class_count + class_of(ch)];
+    }
+
+    CV_CONSTEXPR14 void add_class(charT ch) {
+        if (class_of(ch) != 0)
+            return;
+
+        const class_type new_class = static_cast<class_type>(m_class_count++);
+        if (static_cast<uchar_type>(ch) < narrow_class_count) {
+            m_class[static_cast<uchar_type>(ch)] = new_class;
+            return;
+        }
+
+        // insert keeping order
+        m_wide_chars.push_back(ch);
+        m_wide_classes.push_back(new_class);
+        size_t pos = m_wide_chars.size() - 1;
+        while ((pos > 0) && (ch < m_wide_chars[pos - 1])) {
+            m_wide_chars[pos] = m_wide_chars[pos - 1];
+            m_wide_classes[pos] = m_wide_classes[pos - 1];
+            --pos;
+        }
+        m_wide_chars[pos] = ch;
+        m_wide_classes[pos] = new_class;
+    }
+
+    CV_CONSTEXPR14 state_type add_state() {
+        const state_type res = static_cast<state_type>(m_fail.size());
+        m_delta.resize(m_delta.size() + m_class_count, no_state);
+        m_fail.push_back(0);
+        m_output.push_back(no_state);
+        m_report.push_back(no_state);
+        return res;
+    }
+
+    template<class InputIt>
+    CV_CONSTEXPR14 void build(InputIt a_first, InputIt a_last) {
+        for(InputIt it = a_first; it != a_last; ++it)
+            for(size_t i = 0; i < (*it).size(); ++i)
+                add_class((*it).data()[i]);
+
+        // trie
+        add_state();
+        for(InputIt it = a_first; it != a_last; ++it) {
+            const size_t pattern_index = m_pattern_size.size();
+            m_pattern_size.push_back((*it).size());
+            if ((*it).size() == 0)
+                continue;
+
+            state_type state = 0;
+            for(size_t i = 0; i < (*it).size(); ++i) {
+                const size_t pos = state * m_class_count + class_of((*it).data()[i]);
+                if (m_delta[pos] == no_state) {
+                    const state_type new_state = add_state();
+                    m_delta[pos] = new_state;
+                }
+                state = m_delta[pos];
+            }
+
+            if (m_output[state] == no_state) {
+                m_output[state] = static_cast<state_type>(pattern_index);
+                m_report[state] = state;
+            }
+        }
+
+        // failure links & missing transitions, in BFS order
+        state_table queue;
+        for(size_t c = 0; c < m_class_count; ++c) {
+            const state_type child = m_delta[c];
+            if (child == no_state) {
+                m_delta[c] = 0;
+            } else {
+                m_fail[child] = 0;
+                queue.push_back(child);
+            }
+        }
+
+        for(size_t head = 0; head < queue.size(); ++head) {
+            const state_type state = queue[head];
+            const state_type fail = m_fail[state];
+            for(size_t c = 0; c < m_class_count; ++c) {
+                const size_t pos = state * m_class_count + c;
+                const state_type child = m_delta[pos];
+                if (child == no_state) {
+                    m_delta[pos] = m_delta[fail * m_class_count + c];
+                } else {
+                    const state_type child_fail = m_delta[fail * m_class_count + c];
+                    m_fail[child] = child_fail;
+                    if (m_report[child] == no_state)
+                        m_report[child] = m_report[child_fail];
+                    queue.push_back(child);
+                }
+            }
+        }
+    }
+};
+
+template<class charT, size_t MaxStates, size_t MaxClasses>
+constexpr typename basic_char_view_matcher<charT, MaxStates, MaxClasses>::state_type basic_char_view_matcher<charT, MaxStates, MaxClasses>::no_state;
+
+typedef basic_char_view_matcher<char> char_view_matcher;
+typedef basic_char_view_matcher<wchar_t> wchar_view_matcher;
+typedef basic_char_view_matcher<char16_t> char16_view_matcher;
+typedef basic_char_view_matcher<char32_t> char32_view_matcher;
+
+/**
+  * @brief String switch: list of case labels with hash_code values checked in compile time.
+  * @details Input is hashed once, its hash is located among label hashes (sorted in compile time) with binary search
+  * and confirmed with one equals check,
+  * so input with hash equal to one of labels is never routed to that label by accident.
+  * Returned value is hash_code of matched label (with HashPolicyDeterministic, whatever the policy of labels) or no_match,
+  * usable in switch statement:
+  *
+  *     constexpr auto commands = make_string_switch("clear"_cv, "print"_cv);
+  *     static_assert(commands.distinct(), "hash collision");  // or use CV_STRING_SWITCH macro
+  *     switch (commands(input)) {
+  *         case commands.label("clear"): ...
+  *         case commands.label("print"): ...
+  *         default: ...
+  *     }
+  *
+  * label() fails to compile for text which is not one of labels.
+  */
+template<class charT, size_t N>
+class basic_string_switch
+{
+public:
+    typedef basic_char_view<charT> view_type;
+    typedef unsigned long long hash_type;
+
+    /// returned for input not equal to any label
+    static constexpr hash_type no_match = ~0ULL;
+
+private:
+    view_type m_labels[N];
+    hash_type m_hashes[N];
+    // indexes of labels in order of hashes (ascending), for binary search of input hash
+    size_t m_order[N];
+
+#ifdef CV_HAS_CONSTEXPR14
+    constexpr size_t find_label(const view_type &a_label) const {
+        for(size_t i = 0; i < N; ++i)
+            if (m_labels[i].equals(a_label))
+                return i;
+        return N;
+    }
+#else
+    constexpr bool distinct(size_t i, size_t j) const {
+        return (i >= N) ? true :
+               (j >= N) ? ((m_hashes[i] != no_match) && distinct(i + 1, i + 2)) :
+               (m_hashes[i] != m_hashes[j]) && distinct(i, j + 1);
+    }
+
+    constexpr size_t find_label(const view_type &a_label, size_t a_index = 0) const {
+        return (a_index >= N) ? N :
+               m_labels[a_index].equals(a_label) ? a_index :
+                  find_label(a_label, a_index + 1);
+    }
+#endif
+
+    constexpr hash_type label_hash(size_t a_index) const {
+        return (a_index < N) ? m_hashes[a_index] : throw std::logic_error("basic_string_switch - unknown label");
+    }
+
+#ifndef CV_HAS_CONSTEXPR14
+    // returns number of labels before label a_index in order of hashes (equal hashes ordered by index)
+    constexpr size_t hash_rank(size_t a_index, size_t a_other) const {
+        return (a_other >= N) ? 0 :
+               (((m_hashes[a_other] < m_hashes[a_index]) || ((m_hashes[a_other] == m_hashes[a_index]) && (a_other < a_index))) ? 1 : 0) +
+                  hash_rank(a_index, a_other + 1);
+    }
+
+    // returns index of label with a given rank
+    constexpr size_t label_of_rank(size_t a_rank, size_t a_index) const {
+        return (a_index >= N) ? N :
+               (hash_rank(a_index, 0) == a_rank) ? a_index :
+                  label_of_rank(a_rank, a_index + 1);
+    }
+
+    template<size_t... I, class... Labels>
+    constexpr basic_string_switch(details::index_list<I...>, const Labels&... a_labels):
+        m_labels{view_type(a_labels.data(), a_labels.size())...},
+        m_hashes{HashPolicyDeterministic::hash_chars(a_labels.data(), a_labels.size(), RecursivePolicyEnabled())...},
+        m_order{label_of_rank(I, 0)...}
+    {
+    }
+#endif
+
+public:
+#ifdef CV_HAS_CONSTEXPR14
+    template<class... Labels>
+    constexpr explicit basic_string_switch(const Labels&... a_labels):
+        m_labels{view_type(a_labels.data(), a_labels.size())...},
+        m_hashes{HashPolicyDeterministic::hash_chars(a_labels.data(), a_labels.size(), RecursivePolicyEnabled())...},
+        m_order()
+    {
+        // insertion sort of label indexes by hash, equal hashes keep order of labels
+        for(size_t i = 0; i < N; ++i) {
+            size_t j = i;
+            for(; (j > 0) && (m_hashes[m_order[j - 1]] > m_hashes[i]); --j)
+                m_order[j] = m_order[j - 1];
+            m_order[j] = i;
+        }
+    }
+#else
+    // C++11: order of hashes is calculated by ranking each label (recursive, for small number of labels)
+    template<class... Labels>
+    constexpr explicit basic_string_switch(const Labels&... a_labels):
+        basic_string_switch(typename details::make_index_list<N>::type(), a_labels...)
+    {
+    }
+#endif
 
-private:
-    size_t find_first_of(const charT* a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_of(a_str);
-    }
+    /// returns number of labels
+    constexpr size_t size() const { return N; }
 
-    constexpr size_t find_first_of(const charT* a_str, RecursivePolicyEnabled) const {
-        return details::index_of_any(m_str, a_str, m_size, details::length(a_str));
+    /// returns true if hashes of all labels are different (and different from no_match)
+#ifdef CV_HAS_CONSTEXPR14
+    constexpr bool distinct() const {
+        // equal hashes are neighbours in sorted order, no_match is the greatest hash
+        for(size_t i = 1; i < N; ++i)
+            if (m_hashes[m_order[i - 1]] == m_hashes[m_order[i]])
+                return false;
+        return m_hashes[m_order[N - 1]] != no_match;
     }
+#else
+    constexpr bool distinct() const {
+        return distinct(0, 1);
+    }
+#endif
 
-    size_t find_first_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_of(a_str, 0, a_len);
+    /// returns hash_code of a given label, for use as case value - fails to compile if label is not on the list
+    constexpr hash_type label(const view_type &a_label) const {
+        return label_hash(find_label(a_label));
     }
 
-    constexpr size_t find_first_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
-        return details::index_of_any(m_str, a_str, m_size, a_len);
+    /// returns hash_code of a given label, for use as case value
+    constexpr hash_type label(const charT* a_label) const {
+        return label(view_type(a_label));
     }
 
-    size_t find_first_of(const this_type &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_of(a_str.m_str, 0, a_str.m_size);
+    /// returns hash_code of label equal to input or no_match
+    hash_type operator()(const charT* a_input, size_t a_len) const {
+        const hash_type hash = details::rt::hash_chars(a_input, a_len);
+        size_t first = 0;
+        size_t count = N;
+        while (count > 1) {
+            const size_t half = count / 2;
+            if (m_hashes[m_order[first + half]] <= hash) {
+                first += half;
+                count -= half;
+            } else {
+                count = half;
+            }
+        }
+        const view_type &label = m_labels[m_order[first]];
+        return ((m_hashes[m_order[first]] == hash) && (label.size() == a_len) &&
+                (std::char_traits<charT>::compare(label.data(), a_input, a_len) == 0)) ? hash : no_match;
     }
 
-    constexpr size_t find_first_of(const this_type &a_str, RecursivePolicyEnabled) const {
-        return details::index_of_any(m_str, a_str.m_str, m_size, a_str.m_size);
+    /// overload for char_view
+    template<typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    hash_type operator()(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_input) const {
+        return (*this)(a_input.data(), a_input.size());
     }
 
-    size_t find_first_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_of(a_str);
+    /// overload for standard string
+    hash_type operator()(const std::basic_string<charT> &a_input) const {
+        return (*this)(a_input.c_str(), a_input.size());
     }
 
-    size_t find_first_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
-        return details::index_of_any(m_str, a_str.c_str(), m_size, a_str.size());
+    /// overload for zstring
+    hash_type operator()(const charT* a_input) const {
+        return (*this)(a_input, std::char_traits<charT>::length(a_input));
     }
+};
+
+template<class charT, size_t N>
+constexpr typename basic_string_switch<charT, N>::hash_type basic_string_switch<charT, N>::no_match;
 
+/**
+  * @brief Read-only map with string keys and minimal perfect hash, built in compile time (C++14) from {key, value} pairs.
+  * @details Keys are distributed into N buckets using deterministic hash_code, each bucket gets displacement
+  * which moves its keys to free slots (hash & displace). Lookup requires one hash_code, two table reads
+  * and one length-checked compare, nothing is allocated.
+  *
+  *     constexpr auto verbs = make_constexpr_map<char_view, int>({ {"GET"_cv, 1}, {"PUT"_cv, 2} });
+  *     const int *handler = verbs.find(input);
+  *
+  * Keys (views) must outlive the map. Value must be default-constructible and copy-assignable,
+  * literal type for compile-time construction. With C++11 map can be built in runtime only.
+  */
+template<class Key, class Value, size_t N>
+class constexpr_map
+{
 public:
-    /// \defgroup find_first_of
-    /// @brief Find position of first character in this string which is included in provided character set.
-    /// @param[in] a_str character set
-    /// @return returns position of first matching character inside this string (zero-based) or basic_char_view::npos if not found.
-    //@{
-    /// @brief Find position of first character in this string which is included in provided character set.
-    /// @details Overload for zstring.
-    constexpr size_t find_first_of(const charT* a_str) const {
-        return find_first_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
-    }
+    typedef Key key_type;
+    typedef Value mapped_type;
+    typedef std::pair<Key, Value> value_type;
+    typedef typename Key::value_type char_type;
+    typedef constexpr_map<Key, Value, N> this_type;
 
-    /// @brief overload for character buffer
-    /// @param[in] a_len number of characters inside a_str string
-    constexpr size_t find_first_of_cn(const charT* a_str, size_t a_len) const {
-        return find_first_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
-    }
+private:
+    static_assert(N > 0, "constexpr_map requires at least one item");
 
-    /// @brief overload for char_view
-    constexpr size_t find_first_of(const this_type &a_str) const {
-        return find_first_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
-    }
+    // maximum number of displacements checked for bucket
+    enum { max_displacement = 1 << 16 };
 
-    /// @brief overload for standard string
-    size_t find_first_of(const std::basic_string<charT> &a_str) const {
-        return find_first_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
-    }
-    //@}
+    // items in slot order
+    const char_type* m_key_str[N];
+    size_t m_key_size[N];
+    Value m_values[N];
+    // for bucket: seed of slot mixer and offset added to slot
+    unsigned int m_seed[N];
+    unsigned int m_offset[N];
 
-private:
-    size_t find_first_not_of(const charT* a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_not_of(a_str);
+    static constexpr size_t bucket_of(unsigned long long a_hash) {
+        return static_cast<size_t>((a_hash >> 32) % N);
     }
 
-    constexpr size_t find_first_not_of(const charT* a_str, RecursivePolicyEnabled) const {
-        return details::index_of_nonmatching(m_str, a_str, m_size, details::length(a_str));
+    static constexpr size_t slot_of(unsigned long long a_hash, unsigned long long a_seed, unsigned long long a_offset) {
+        return static_cast<size_t>(((((a_hash ^ (a_seed * 0x9e3779b97f4a7c15ULL)) * 0xbf58476d1ce4e5b9ULL) >> 32) + a_offset) % N);
     }
 
-    size_t find_first_not_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_not_of(a_str, 0, a_len);
+    constexpr size_t slot_of(unsigned long long a_hash) const {
+        return slot_of(a_hash, m_seed[bucket_of(a_hash)], m_offset[bucket_of(a_hash)]);
     }
 
-    constexpr size_t find_first_not_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
-        return details::index_of_nonmatching(m_str, a_str, m_size, a_len);
+    template<class View>
+    constexpr size_t checked_slot(const View &a_key, size_t a_slot) const {
+        return a_key.equals(m_key_str[a_slot], m_key_size[a_slot]) ? a_slot : N;
     }
 
-    size_t find_first_not_of(const this_type &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_not_of(a_str.m_str, 0, a_str.m_size);
+    // hash of key, independent from hash policy of view
+    template<class View>
+    static constexpr unsigned long long key_hash(const View &a_key) {
+        return HashPolicyDeterministic::hash_chars(a_key.data(), a_key.size(),
+                                                   typename RecursivePolicyTag<typename View::recursive_policy>::type());
     }
 
-    constexpr size_t find_first_not_of(const this_type &a_str, RecursivePolicyEnabled) const {
-        return details::index_of_nonmatching(m_str, a_str.m_str, m_size, a_str.size());
+    template<class View>
+    constexpr size_t find_slot(const View &a_key) const {
+        return checked_slot(a_key, slot_of(key_hash(a_key)));
     }
 
-    size_t find_first_not_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_first_not_of(a_str);
+    // runtime lookup of character buffer
+    size_t find_slot(const char_type* a_key, size_t a_len) const {
+        const size_t slot = slot_of(details::rt::hash_chars(a_key, a_len));
+        return ((m_key_size[slot] == a_len) && (std::char_traits<char_type>::compare(m_key_str[slot], a_key, a_len) == 0)) ? slot : N;
     }
 
-    size_t find_first_not_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
-        return details::index_of_nonmatching(m_str, a_str.c_str(), m_size, a_str.size());
+    constexpr const Value &value_at(size_t a_slot) const {
+        return (a_slot < N) ? m_values[a_slot] : throw std::out_of_range("constexpr_map - key not found");
     }
 
-public:
-    /// \defgroup find_first_not_of
-    /// @brief Find position of first character in this string which is NOT included in provided character set.
-    /// @param[in] a_str character set
-    /// @return returns position of first non-matching character inside this string (zero-based) or basic_char_view::npos if not found.
-    //@{
-    /// @brief Find position of first character in this string which is NOT included in provided character set.
-    /// @details Overload for zstring.
-    constexpr size_t find_first_not_of(const charT* a_str) const {
-        return find_first_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    constexpr const Value *value_ptr(size_t a_slot) const {
+        return (a_slot < N) ? &m_values[a_slot] : nullptr;
     }
 
-    /// @brief overload for character buffer
-    /// @param[in] a_len number of characters inside a_str string
-    constexpr size_t find_first_not_of_cn(const charT* a_str, size_t a_len) const {
-        return find_first_not_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
-    }
+    // access to key & value of {key, value} item
+    struct key_first {
+        static constexpr const Key &key(const std::pair<Key, Value> &a_item) { return a_item.first; }
+        static constexpr const Value &value(const std::pair<Key, Value> &a_item) { return a_item.second; }
+    };
 
-    /// @brief overload for char_view
-    constexpr size_t find_first_not_of(const this_type &a_str) const {
-        return find_first_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
-    }
+    // access to key & value of {value, key} item
+    struct key_second {
+        static constexpr const Key &key(const std::pair<Value, Key> &a_item) { return a_item.second; }
+        static constexpr const Value &value(const std::pair<Value, Key> &a_item) { return a_item.first; }
+    };
 
-    /// @brief overload for standard string
-    size_t find_first_not_of(const std::basic_string<charT> &a_str) const {
-        return find_first_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    // builds perfect hash & fills slots, throws std::logic_error on duplicated key
+    template<class Access, class Item>
+    CV_CONSTEXPR14 void build(const Item (&a_items)[N])
+    {
+        unsigned long long hashes[N] = {};
+        size_t bucket_size[N] = {};
+        size_t max_bucket_size = 0;
+
+        for(size_t i = 0; i < N; ++i) {
+            hashes[i] = key_hash(Access::key(a_items[i]));
+            const size_t bucket = bucket_of(hashes[i]);
+            if (++bucket_size[bucket] > max_bucket_size)
+                max_bucket_size = bucket_size[bucket];
+            for(size_t j = 0; j < i; ++j)
+                if (Access::key(a_items[i]).equals(Access::key(a_items[j]).data(), Access::key(a_items[j]).size()))
+                    throw std::logic_error("constexpr_map - duplicated key");
+        }
+
+        bool used[N] = {};
+        size_t item_slot[N] = {};
+
+        // buckets with many keys first, while most of slots are free
+        for(size_t size = max_bucket_size; size > 1; --size) {
+            for(size_t bucket = 0; bucket < N; ++bucket) {
+                if (bucket_size[bucket] != size)
+                    continue;
+
+                for(unsigned int seed = 0; ; ++seed) {
+                    if (seed == max_displacement)
+                        throw std::logic_error("constexpr_map - perfect hash not found");
+
+                    size_t slots[N] = {};
+                    size_t count = 0;
+                    for(size_t i = 0; (i < N) && (count < size); ++i) {
+                        if (bucket_of(hashes[i]) != bucket)
+                            continue;
+                        const size_t slot = slot_of(hashes[i], seed, 0);
+                        bool free = !used[slot];
+                        for(size_t j = 0; free && (j < count); ++j)
+                            free = (slots[j] != slot);
+                        if (!free)
+                            break;
+                        slots[count++] = slot;
+                        item_slot[i] = slot;
+                    }
+
+                    if (count == size) {
+                        for(size_t j = 0; j < count; ++j)
+                            used[slots[j]] = true;
+                        m_seed[bucket] = seed;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // single-key buckets are moved to free slots with offset
+        size_t free_slot = 0;
+        for(size_t i = 0; i < N; ++i) {
+            const size_t bucket = bucket_of(hashes[i]);
+            if (bucket_size[bucket] != 1)
+                continue;
+            while (used[free_slot])
+                ++free_slot;
+            used[free_slot] = true;
+            item_slot[i] = free_slot;
+            m_offset[bucket] = static_cast<unsigned int>((free_slot + N - slot_of(hashes[i], 0, 0)) % N);
+        }
+
+        for(size_t i = 0; i < N; ++i) {
+            m_key_str[item_slot[i]] = Access::key(a_items[i]).data();
+            m_key_size[item_slot[i]] = Access::key(a_items[i]).size();
+            m_values[item_slot[i]] = Access::value(a_items[i]);
+        }
     }
-    //@}
 
-private:
-    size_t find_last_of(const charT* a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_of(a_str);
+    template<class Enum, class View, size_t M, size_t Range> friend class enum_table;
+
+    // builds map from array of {value, key} pairs, for enum_table
+    CV_CONSTEXPR14 constexpr_map(const std::pair<Value, Key> (&a_items)[N], key_second):
+        m_key_str(), m_key_size(), m_values(), m_seed(), m_offset()
+    {
+        build<key_second>(a_items);
     }
 
-    constexpr size_t find_last_of(const charT* a_str, RecursivePolicyEnabled) const {
-        return details::last_index_of_any(m_str, a_str, m_size, details::length(a_str));
+public:
+    /// @brief Builds map from array of {key, value} pairs, throws std::logic_error on duplicated key.
+    CV_CONSTEXPR14 explicit constexpr_map(const value_type (&a_items)[N]):
+        m_key_str(), m_key_size(), m_values(), m_seed(), m_offset()
+    {
+        build<key_first>(a_items);
     }
 
-    size_t find_last_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_of(a_str, std::string::npos, a_len);
+    /// returns number of items
+    constexpr size_t size() const { return N; }
+
+    /// returns true if map contains a given key
+    template<class View>
+    constexpr bool contains(const View &a_key) const {
+        return find_slot(a_key) < N;
     }
 
-    constexpr size_t find_last_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
-        return details::last_index_of_any(m_str, a_str, m_size, a_len);
+    /// returns value for a given key, throws std::out_of_range if key not found
+    template<class View>
+    constexpr const Value &at(const View &a_key) const {
+        return value_at(find_slot(a_key));
     }
 
-    size_t find_last_of(const this_type &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_of(a_str.m_str, std::string::npos, a_str.m_size);
+    /// returns pointer to value for a given key or nullptr
+    template<class View>
+    constexpr const Value *find(const View &a_key) const {
+        return value_ptr(find_slot(a_key));
     }
 
-    constexpr size_t find_last_of(const this_type &a_str, RecursivePolicyEnabled) const {
-        return details::last_index_of_any(m_str, a_str.m_str, m_size, a_str.m_size);
+    /// overload for standard string
+    const Value *find(const std::basic_string<char_type> &a_key) const {
+        return value_ptr(find_slot(a_key.c_str(), a_key.size()));
     }
 
-    size_t find_last_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_of(a_str);
+    /// overload for character buffer
+    const Value *find(const char_type* a_key, size_t a_len) const {
+        return value_ptr(find_slot(a_key, a_len));
     }
 
-    size_t find_last_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
-        return details::last_index_of_any(m_str, a_str.c_str(), m_size, a_str.size());
+    /// overload for zstring
+    const Value *find(const char_type* a_key) const {
+        return find(a_key, std::char_traits<char_type>::length(a_key));
     }
+};
+
+/**
+  * @brief Table of enum values & their names with lookup in both directions, built in compile time (C++14).
+  * @details name() reads dense array indexed by value (minus the smallest value), find() uses minimal perfect hash
+  * of names (see constexpr_map), nothing is allocated in either direction.
+  *
+  *     enum class color { red, green, blue };
+  *     constexpr auto colors = make_enum_table<color>({ {color::red, "red"_cv}, {color::green, "green"_cv}, {color::blue, "blue"_cv} });
+  *     static_assert(colors.name(color::green) == "green"_cv, "");
+  *     const color *value = colors.find(input);
+  *
+  * Duplicated name fails compilation of constexpr table (throws std::logic_error in runtime), CV_ENUM_TABLE
+  * additionally reports it with static_assert. Values can repeat (aliases),
+  * name() returns first name of value. Range is size of dense array, by default number of names - enums with gaps
+  * need greater Range (greatest value - smallest value + 1). Names (views) must outlive the table.
+  */
+template<class Enum, class View, size_t N, size_t Range = N>
+class enum_table
+{
 public:
-    /// \defgroup find_last_of
-    /// @brief Find last position of character in this string which is included in provided character set.
-    /// @param[in] a_str character set
-    /// @return returns position of last matching character inside this string (zero-based) or basic_char_view::npos if not found.
-    //@{
-    /// @brief Find last position of character in this string which is included in provided character set.
-    /// @details Overload for zstring.
-    constexpr size_t find_last_of(const charT* a_str) const {
-        return find_last_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
-    }
+    typedef Enum enum_type;
+    typedef View view_type;
+    typedef std::pair<Enum, View> value_type;
+    typedef typename View::value_type char_type;
 
-    /// @brief overload for character buffer
-    /// @param[in] a_len number of characters inside a_str string
-    constexpr size_t find_last_of_cn(const charT* a_str, size_t a_len) const {
-        return find_last_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+private:
+    static_assert(std::is_enum<Enum>::value, "enum_table requires enum type");
+    static_assert(Range > 0, "enum_table requires non-empty range");
+
+    typedef constexpr_map<View, Enum, N> map_type;
+
+    map_type m_values;
+    long long m_min;
+    // dense array of names, nullptr for values without name
+    const char_type* m_name_str[Range];
+    size_t m_name_size[Range];
+
+    static constexpr long long ordinal(Enum a_value) {
+        return static_cast<long long>(static_cast<typename std::underlying_type<Enum>::type>(a_value));
     }
 
-    /// @brief overload for char_view
-    constexpr size_t find_last_of(const this_type &a_str) const {
-        return find_last_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    static CV_CONSTEXPR14 long long min_ordinal(const value_type (&a_items)[N]) {
+        long long res = ordinal(a_items[0].first);
+        for(size_t i = 1; i < N; ++i)
+            if (ordinal(a_items[i].first) < res)
+                res = ordinal(a_items[i].first);
+        return res;
     }
 
-    /// @brief overload for standard string
-    size_t find_last_of(const std::basic_string<charT> &a_str) const {
-        return find_last_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    // returns index in dense array or Range if value is outside of it
+    constexpr size_t index_of(Enum a_value) const {
+        return ((ordinal(a_value) >= m_min) &&
+                (static_cast<unsigned long long>(ordinal(a_value)) - static_cast<unsigned long long>(m_min) < Range)) ?
+                  static_cast<size_t>(static_cast<unsigned long long>(ordinal(a_value)) - static_cast<unsigned long long>(m_min)) :
+                  Range;
     }
-    //@}
 
-private:
-    size_t find_last_not_of(const charT* a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_not_of(a_str);
+public:
+    /// @brief Builds table from array of {value, name} pairs, throws std::logic_error on duplicated name or value outside of Range.
+    CV_CONSTEXPR14 explicit enum_table(const value_type (&a_items)[N]):
+        m_values(a_items, typename map_type::key_second()), m_min(min_ordinal(a_items)), m_name_str(), m_name_size()
+    {
+        for(size_t i = 0; i < N; ++i) {
+            const size_t index = index_of(a_items[i].first);
+            if (index == Range)
+                throw std::logic_error("enum_table - value outside of range");
+            if (m_name_str[index] == nullptr) {
+                m_name_str[index] = a_items[i].second.data();
+                m_name_size[index] = a_items[i].second.size();
+            }
+        }
     }
 
-    constexpr size_t find_last_not_of(const charT* a_str, RecursivePolicyEnabled) const {
-        return details::last_index_of_nonmatching(m_str, a_str, m_size, length(a_str, RecursivePolicyEnabled()));
+    /// returns number of names
+    constexpr size_t size() const { return N; }
+
+    /// returns true if value has name
+    constexpr bool contains(Enum a_value) const {
+        return (index_of(a_value) < Range) && (m_name_str[index_of(a_value)] != nullptr);
     }
 
-    size_t find_last_not_of(const charT* a_str, size_t a_len, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_not_of(a_str, std::string::npos, a_len);
+    /// returns name of value, empty view (with nullptr data) if value has no name
+    constexpr View name(Enum a_value) const {
+        return contains(a_value) ? View(m_name_str[index_of(a_value)], m_name_size[index_of(a_value)]) : View(nullptr, 0);
     }
 
-    constexpr size_t find_last_not_of(const charT* a_str, size_t a_len, RecursivePolicyEnabled) const {
-        return details::last_index_of_nonmatching(m_str, a_str, m_size, a_len);
+    /// returns pointer to value with a given name or nullptr
+    template<class Text>
+    constexpr const Enum *find(const Text &a_name) const {
+        return m_values.find(a_name);
     }
 
-    size_t find_last_not_of(const this_type &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_not_of(a_str.m_str, std::string::npos, a_str.m_size);
+    /// overload for character buffer
+    const Enum *find(const char_type* a_name, size_t a_len) const {
+        return m_values.find(a_name, a_len);
     }
 
-    constexpr size_t find_last_not_of(const this_type &a_str, RecursivePolicyEnabled) const {
-        return details::last_index_of_nonmatching(m_str, a_str.m_str, m_size, a_str.m_size);
+    /// returns value with a given name, throws std::out_of_range if name not found
+    template<class Text>
+    constexpr Enum at(const Text &a_name) const {
+        return m_values.at(a_name);
     }
+};
 
-    size_t find_last_not_of(const std::basic_string<charT> &a_str, RecursivePolicyDisabled) const {
-        return std::basic_string<charT>(m_str, m_size).find_last_not_of(a_str);
+namespace details
+{
+    // returns end of delimiter found at a_found inside field starting at a_pos, npos if not found
+    constexpr size_t split_delim_end(size_t a_pos, size_t a_found, size_t a_delim_len) {
+        return (a_found == size_t(-1)) ? size_t(-1) : a_pos + a_found + a_delim_len;
     }
 
-    size_t find_last_not_of(const std::basic_string<charT> &a_str, RecursivePolicyEnabled) const {
-        return details::last_index_of_nonmatching(m_str, a_str.c_str(), m_size, a_str.size());
+    // returns position of delimiter inside field starting at a_pos, npos if not found or delimiter is empty
+    template<class View>
+    constexpr size_t split_find(const View &a_str, const View &a_delim, size_t a_pos) {
+        return a_delim.empty() ? View::npos : View(a_str.data() + a_pos, a_str.size() - a_pos).find(a_delim);
     }
 
-public:
-    /// \defgroup find_last_not_of
-    /// @brief Find last position of character in this string which is NOT included in provided character set.
-    /// @param[in] a_str character set
-    /// @return returns position of last non-matching character inside this string (zero-based) or basic_char_view::npos if not found.
-    //@{
-    /// @brief Find last position of character in this string which is NOT included in provided character set.
-    /// @details Overload for zstring.
-    constexpr size_t find_last_not_of(const charT* a_str) const {
-        return find_last_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    // returns start of field a_index, npos if text has less fields (a_pos: start of current field)
+    template<class View>
+    constexpr size_t split_field_start(const View &a_str, const View &a_delim, size_t a_index, size_t a_pos) {
+        return ((a_index == 0) || (a_pos == View::npos)) ? a_pos :
+               split_field_start(a_str, a_delim, a_index - 1,
+                                 split_delim_end(a_pos, split_find(a_str, a_delim, a_pos), a_delim.size()));
     }
 
-    /// @brief overload for character buffer
-    /// @param[in] a_len number of characters inside a_str string
-    constexpr size_t find_last_not_of_cn(const charT* a_str, size_t a_len) const {
-        return find_last_not_of(a_str, a_len, typename RecursivePolicyTag<RecursivePolicy>::type());
+    // returns field starting at a_start and ending at delimiter found at a_found (npos: at end of text)
+    template<class View>
+    constexpr View split_part(const View &a_str, size_t a_start, size_t a_found) {
+        return View(a_str.data() + a_start, (a_found == View::npos) ? a_str.size() - a_start : a_found);
     }
 
-    /// @brief overload for char_view
-    constexpr size_t find_last_not_of(const this_type &a_str) const {
-        return find_last_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    // returns field a_index, empty view at end of text if text has less fields; last field includes rest of text
+    template<class View>
+    constexpr View split_field(const View &a_str, const View &a_delim, size_t a_index, size_t a_count, size_t a_start) {
+        return (a_start == View::npos) ? View(a_str.data() + a_str.size(), 0) :
+               (a_index + 1 == a_count) ? split_part(a_str, a_start, View::npos) :
+               split_part(a_str, a_start, split_find(a_str, a_delim, a_start));
     }
 
-    /// @brief overload for standard string
-    size_t find_last_not_of(const std::basic_string<charT> &a_str) const {
-        return find_last_not_of(a_str, typename RecursivePolicyTag<RecursivePolicy>::type());
+    template<class View, size_t... I>
+    constexpr std::array<View, sizeof...(I)> split(const View &a_str, const View &a_delim, index_list<I...>) {
+        return std::array<View, sizeof...(I)>{{ split_field(a_str, a_delim, I, sizeof...(I), split_field_start(a_str, a_delim, I, 0))... }};
     }
-    //@}
-};
 
-typedef basic_char_view<char> char_view;
-typedef basic_char_view<wchar_t> wchar_view;
-typedef basic_char_view<char16_t> char16_view;
-typedef basic_char_view<char32_t> char32_view;
+#ifdef CV_HAS_CONSTEXPR14
+    template<class View>
+    constexpr size_t count_split(const View &a_str, const View &a_delim) {
+        size_t count = 1;
+        for(size_t pos = split_delim_end(0, split_find(a_str, a_delim, 0), a_delim.size()); pos != View::npos;
+            pos = split_delim_end(pos, split_find(a_str, a_delim, pos), a_delim.size()))
+            ++count;
+        return count;
+    }
+#else
+    template<class View>
+    constexpr size_t count_split(const View &a_str, const View &a_delim, size_t a_pos = 0) {
+        return (a_pos == View::npos) ? 0 :
+               1 + count_split(a_str, a_delim, split_delim_end(a_pos, split_find(a_str, a_delim, a_pos), a_delim.size()));
+    }
+#endif
+}
 
 // ----------------------------------------------------------------------------
 // Global functions, operators
@@ -1433,20 +5453,143 @@ constexpr char16_view operator "" _cv(const char16_t* s, std::size_t n) { return
 constexpr char32_view operator "" _cv(const char32_t* s, std::size_t n) { return char32_view(s, n); }
 #endif
 
-}; // namespace
+/// Creates string switch from list of case labels (views), see basic_string_switch
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy, class... Labels>
+constexpr basic_string_switch<charT, 1 + sizeof...(Labels)> make_string_switch(
+    const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_first, const Labels&... a_labels)
+{
+    return basic_string_switch<charT, 1 + sizeof...(Labels)>(a_first, a_labels...);
+}
 
-template<typename charT>
-  constexpr bool operator<(const sbt::basic_char_view<charT>& ltr, const sbt::basic_char_view<charT>& rtr) { return rtr.compare(ltr) > 0; }
-template<typename charT>
-  constexpr bool operator<=(const sbt::basic_char_view<charT>& ltr, const sbt::basic_char_view<charT>& rtr) { return rtr.compare(ltr) >= 0; }
-template<typename charT>
-  constexpr bool operator>(const sbt::basic_char_view<charT>& ltr, const sbt::basic_char_view<charT>& rtr) { return rtr.compare(ltr) < 0; }
-template<typename charT>
-  constexpr bool operator>=(const sbt::basic_char_view<charT>& ltr, const sbt::basic_char_view<charT>& rtr) { return rtr.compare(ltr) <= 0; }
-template<typename charT>
-  constexpr bool operator==(const sbt::basic_char_view<charT>& ltr, const sbt::basic_char_view<charT>& rtr) { return rtr.equals(ltr); }
-template<typename charT>
-  constexpr bool operator!=(const sbt::basic_char_view<charT>& ltr, const sbt::basic_char_view<charT>& rtr) { return rtr.compare(ltr) != 0; }
+/// Creates basic_fixed_string from string literal, e.g. make_fixed_string("GET") (fixed_string<3>)
+template<class charT, size_t N>
+CV_CONSTEXPR14 basic_fixed_string<charT, N - 1> make_fixed_string(const charT (&a_str)[N])
+{
+    return basic_fixed_string<charT, N - 1>(a_str);
+}
+
+/// Creates constexpr_map from array of {key, value} pairs, e.g. make_constexpr_map<char_view, int>({{"a"_cv, 1}, {"b"_cv, 2}})
+template<class Key, class Value, size_t N>
+CV_CONSTEXPR14 constexpr_map<Key, Value, N> make_constexpr_map(const std::pair<Key, Value> (&a_items)[N])
+{
+    return constexpr_map<Key, Value, N>(a_items);
+}
+
+/// @brief Creates enum_table from array of {value, name} pairs, e.g. make_enum_table<color>({{color::red, "red"_cv}, {color::blue, "blue"_cv}}).
+/// Range is size of dense array, 0 - number of pairs.
+template<class Enum, class View = char_view, size_t Range = 0, size_t N>
+CV_CONSTEXPR14 enum_table<Enum, View, N, (Range ? Range : N)> make_enum_table(const std::pair<Enum, View> (&a_items)[N])
+{
+    return enum_table<Enum, View, N, (Range ? Range : N)>(a_items);
+}
+
+/// Returns true if names in array of {value, name} pairs are unique, for use in static_assert (C++14)
+template<class Enum, class View, size_t N>
+CV_CONSTEXPR14 bool enum_names_unique(const std::pair<Enum, View> (&a_items)[N])
+{
+    for(size_t i = 1; i < N; ++i)
+        for(size_t j = 0; j < i; ++j)
+            if (a_items[i].second.equals(a_items[j].second.data(), a_items[j].second.size()))
+                return false;
+    return true;
+}
+
+/// @brief Splits text into N fields separated with a_delim, in compile time for constexpr views.
+/// @details Last field contains rest of text (including following delimiters), if text has less than N fields
+/// remaining ones are empty views pointing to end of text. Empty delimiter does not split text.
+///
+///     constexpr auto fields = split<3>("host=a;port=b;mode=c"_cv, ';');    // "host=a", "port=b", "mode=c"
+///
+/// @return returns array of views pointing into a_str
+template<size_t N, typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+constexpr std::array<basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>, N>
+    split(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str,
+          const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_delim)
+{
+    static_assert(N > 0, "split requires at least one field");
+    return details::split(a_str, a_delim, typename details::make_index_list<N>::type());
+}
+
+/// @brief overload for zstring delimiter
+template<size_t N, typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+constexpr std::array<basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>, N>
+    split(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str, const charT* a_delim)
+{
+    return split<N>(a_str, basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>(a_delim));
+}
+
+/// @brief overload for single character delimiter
+template<size_t N, typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+constexpr std::array<basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>, N>
+    split(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str, const charT &a_delim)
+{
+    return split<N>(a_str, basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>(&a_delim, 1));
+}
+
+/// @brief Returns number of fields separated with a_delim (number of delimiters + 1), e.g. size for split<N>.
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+constexpr size_t count_split(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str,
+                             const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_delim)
+{
+    return details::count_split(a_str, a_delim);
+}
+
+/// @brief overload for zstring delimiter
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+constexpr size_t count_split(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str,
+                             const charT* a_delim)
+{
+    return count_split(a_str, basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>(a_delim));
+}
+
+/// @brief overload for single character delimiter
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+constexpr size_t count_split(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &a_str,
+                             const charT &a_delim)
+{
+    return count_split(a_str, basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>(&a_delim, 1));
+}
+
+/// @brief Calculates hash_code of a_count views into a_out (unsigned long long, std::uint64_t or other unsigned 64-bit type).
+/// @details Views are hashed one after another: short keys are read without branches and characters of following views
+/// are prefetched, so cache misses of scattered keys overlap. Returned values are equal to hash_code() of each view.
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy, typename Out>
+void hash_batch(const basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>* a_in,
+                size_t a_count, Out* a_out)
+{
+    static_assert(std::is_integral<Out>::value && std::is_unsigned<Out>::value && (sizeof(Out) == 8),
+                  "hash_batch requires unsigned 64-bit output");
+    details::rt::hash_batch<charT>(a_in, a_count, HashPolicy::hash_seed(), HashPolicy::hash_secrets(), a_out);
+}
+
+/// Defines constexpr string switch with a given name and verifies in compile time that hashes of labels are distinct
+#define CV_STRING_SWITCH(name, ...) \
+    constexpr auto name = ::sbt::make_string_switch(__VA_ARGS__); \
+    static_assert(name.distinct(), "string switch: duplicated label or hash collision")
+
+/// Defines constexpr enum_table with a given name from {value, name} pairs and verifies in compile time that names are unique
+#define CV_ENUM_TABLE(name, Enum, ...) \
+    static_assert(::sbt::enum_names_unique<Enum, ::sbt::char_view>({__VA_ARGS__}), "enum table: duplicated name"); \
+    constexpr auto name = ::sbt::make_enum_table<Enum>({__VA_ARGS__})
+
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+  constexpr bool operator<(const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& ltr,
+                           const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& rtr) { return rtr.compare(ltr) > 0; }
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+  constexpr bool operator<=(const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& ltr,
+                           const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& rtr) { return rtr.compare(ltr) >= 0; }
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+  constexpr bool operator>(const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& ltr,
+                           const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& rtr) { return rtr.compare(ltr) < 0; }
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+  constexpr bool operator>=(const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& ltr,
+                           const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& rtr) { return rtr.compare(ltr) <= 0; }
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+  constexpr bool operator==(const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& ltr,
+                           const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& rtr) { return rtr.equals(ltr); }
+template<typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+  constexpr bool operator!=(const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& ltr,
+                           const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>& rtr) { return rtr.compare(ltr) != 0; }
 
 template<typename charT>
   constexpr bool operator<(const char* ltr, const sbt::basic_char_view<charT>& rtr) { return rtr.compare(ltr) > 0; }
@@ -1500,13 +5643,36 @@ template<typename charT>
 template<typename charT>
     bool operator!=(const sbt::basic_char_view<charT>& ltr, const std::string &rtr) { return ltr.compare(rtr) != 0; }
 
+}; // namespace
+
 namespace std {
     /// standard hash function specialization for char_view
-    template <typename charT> struct hash<sbt::basic_char_view<charT>>
+    template <typename charT, typename RecursivePolicy, typename RangeCheckPolicy, typename ErrorPolicy, typename HashPolicy>
+    struct hash<sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy>>
+    {
+        size_t operator()(const sbt::basic_char_view<charT, RecursivePolicy, RangeCheckPolicy, ErrorPolicy, HashPolicy> &x) const
+        {
+          return static_cast<size_t>(x.hash_code());
+        }
+    };
+
+    /// standard hash function specialization for hashed_char_view: returns stored hash
+    template <typename charT, typename HashPolicy>
+    struct hash<sbt::basic_hashed_char_view<charT, HashPolicy>>
+    {
+        size_t operator()(const sbt::basic_hashed_char_view<charT, HashPolicy> &x) const noexcept
+        {
+          return static_cast<size_t>(x.hash_code());
+        }
+    };
+
+    /// standard hash function specialization for fixed_string
+    template <typename charT, size_t N>
+    struct hash<sbt::basic_fixed_string<charT, N>>
     {
-        size_t operator()(const sbt::basic_char_view<charT> &x) const
+        size_t operator()(const sbt::basic_fixed_string<charT, N> &x) const
         {
-          return x.hash_code();
+          return static_cast<size_t>(x.hash_code());
         }
     };
 
@@ -0,0 +1,566 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        benchMain.cpp
+// Purpose:     Performance benchmarks for char_view.
+// Author:      Piotr Likus
+// Created:     16/10/2026
+// Version:     0.2
+// License:     BSD
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+#include <map>
+#include <unordered_set>
+#include <memory>
+
+#include "char_view.h"
+
+using namespace std;
+using namespace sbt;
+
+// views using iterative (runtime) versions of functions
+typedef basic_char_view<char, RecursivePolicyDisabled> char_view_rt;
+
+namespace {
+
+    // prevents compiler from removing benchmarked code
+    volatile size_t bench_sink = 0;
+
+    // Runs function "repeats" times, returns best time in nanoseconds
+    template<typename Func>
+    double MeasureNs(Func func, int repeats = 7) {
+        double best = 0.0;
+        for(int i = 0; i < repeats; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            bench_sink = bench_sink + func();
+            const auto stop = std::chrono::steady_clock::now();
+            const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+            if (i == 0 || ns < best)
+                best = ns;
+        }
+        return best;
+    }
+
+    void PrintResult(const string &name, size_t bytes, double ns, double base_ns) {
+        cout << "  " << left << setw(44) << name << right
+             << setw(9) << fixed << setprecision(1) << (bytes / ns * 1000.0) << " MB/s"
+             << setw(8) << setprecision(2) << (base_ns / ns) << "x" << endl;
+    }
+
+    // CSV-like text: short fields separated with one of delimiters, lines of ~200 characters
+    string MakeFieldText(size_t size) {
+        const char *words[] = { "alpha", "beta", "gamma_delta", "1234567", "x", "epsilon-zeta", "quoted text here", "3.14159" };
+        const char delims[] = ",;|\t";
+        string res;
+        res.reserve(size);
+        size_t n = 0;
+        while(res.size() < size) {
+            res += words[(n * 7 + n / 3) % 8];
+            res += ((n % 9) == 8) ? '\n' : delims[n % 4];
+            n++;
+        }
+        res.resize(size);
+        return res;
+    }
+
+    // Splits text on any of delimiters, returns number of fields
+    template<typename Find>
+    size_t CountFields(const string &text, Find find) {
+        size_t count = 0;
+        size_t pos = 0;
+        for(;;) {
+            const size_t found = find(pos);
+            count++;
+            if (found == string::npos)
+                break;
+            pos = found + 1;
+        }
+        return count;
+    }
+
+    void BenchFindFirstOf() {
+        const string text = MakeFieldText(1 << 20);
+        const char *delims = ",;|\t\n";
+        const size_t delims_len = strlen(delims);
+        constexpr char_set delim_set(",;|\t\n");
+
+        cout << "find_first_of, " << text.size() << " bytes, fields separated with 5 delimiters:" << endl;
+
+        const double base_ns = MeasureNs([&]() {
+            return CountFields(text, [&](size_t pos) {
+                const ssize_t found = details::index_of_any(text.c_str() + pos, delims, text.size() - pos, delims_len);
+                return (found < 0) ? string::npos : pos + found;
+            });
+        });
+        PrintResult("details::index_of_any (constexpr)", text.size(), base_ns, base_ns);
+
+        PrintResult("std::string::find_first_of", text.size(), MeasureNs([&]() {
+            return CountFields(text, [&](size_t pos) { return text.find_first_of(delims, pos); });
+        }), base_ns);
+
+        PrintResult("char_view_rt::find_first_of(const char *)", text.size(), MeasureNs([&]() {
+            return CountFields(text, [&](size_t pos) {
+                const size_t found = char_view_rt(text.c_str() + pos, text.size() - pos).find_first_of(delims);
+                return (found == char_view_rt::npos) ? string::npos : pos + found;
+            });
+        }), base_ns);
+
+        PrintResult("char_view_rt::find_first_of(char_set)", text.size(), MeasureNs([&]() {
+            return CountFields(text, [&](size_t pos) {
+                const size_t found = char_view_rt(text.c_str() + pos, text.size() - pos).find_first_of(delim_set);
+                return (found == char_view_rt::npos) ? string::npos : pos + found;
+            });
+        }), base_ns);
+
+        // long runs: lines of 4 KB, only line ends are searched
+        string lines;
+        for(int i = 0; i < 256; i++)
+            lines += string(4095, 'a' + i % 26) + "\n";
+        const char_view_rt lines_view(lines.c_str(), lines.size());
+        constexpr char_set line_set("\r\n");
+        const string spaces = string(1 << 20, ' ') + "x";
+        const char_view_rt spaces_view(spaces.c_str(), spaces.size());
+        constexpr char_set space_set(" \t");
+
+        cout << "find_first_of / find_first_not_of on long runs, " << lines.size() << " bytes:" << endl;
+        const double lines_base_ns = MeasureNs([&]() {
+            size_t count = 0;
+            for(size_t pos = 0; pos < lines.size(); count++)
+                pos += details::rt::index_of_set<true, char>(lines.c_str() + pos, line_set, lines.size() - pos) + 1;
+            return count;
+        });
+        PrintResult("scalar bitmap, line ends", lines.size(), lines_base_ns, lines_base_ns);
+        PrintResult("char_view_rt::find_first_of(char_set)", lines.size(), MeasureNs([&]() {
+            size_t count = 0;
+            for(size_t pos = 0; pos < lines.size(); count++)
+                pos += lines_view.substr(pos).find_first_of(line_set) + 1;
+            return count;
+        }), lines_base_ns);
+
+        const double spaces_base_ns = MeasureNs([&]() {
+            return static_cast<size_t>(details::rt::index_of_set<false, char>(spaces.c_str(), space_set, spaces.size()));
+        });
+        PrintResult("scalar bitmap, skip blanks", spaces.size(), spaces_base_ns, spaces_base_ns);
+        PrintResult("char_view_rt::find_first_not_of(char_set)", spaces.size(), MeasureNs([&]() {
+            return spaces_view.find_first_not_of(space_set);
+        }), spaces_base_ns);
+    }
+
+    void BenchTrim() {
+        // fixed-width records: 8 fields of 40 characters, values padded with spaces
+        const size_t field_size = 40;
+        string records;
+        for(size_t n = 0; records.size() < (1 << 20); n++) {
+            const string value(3 + n % 11, 'a' + n % 26);
+            const size_t left = (n % 3 == 0) ? (field_size - value.size()) / 2 : 0;
+            records += string(left, ' ') + value + string(field_size - left - value.size(), ' ');
+        }
+        const size_t field_count = records.size() / field_size;
+
+        cout << "trim, " << field_count << " fields of " << field_size << " characters:" << endl;
+        const double base_ns = MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t i = 0; i < field_count; i++) {
+                const char_view_rt field(records.c_str() + i * field_size, field_size);
+                const size_t first = field.find_first_not_of(" \t\r\n");
+                res += (first == char_view_rt::npos) ? 0 : field.find_last_not_of(" \t\r\n") + 1 - first;
+            }
+            return res;
+        });
+        PrintResult("find_first_not_of + find_last_not_of", records.size(), base_ns, base_ns);
+        PrintResult("char_view_rt::trim", records.size(), MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t i = 0; i < field_count; i++)
+                res += char_view_rt(records.c_str() + i * field_size, field_size).trim().size();
+            return res;
+        }), base_ns);
+    }
+
+    void BenchCount() {
+        const string text = MakeFieldText(1 << 20);
+        const char_view_rt view(text.c_str(), text.size());
+        const char_view_rt needle("gamma");
+
+        cout << "count, " << text.size() << " bytes:" << endl;
+        const double base_ns = MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t pos = view.find(needle); pos != char_view_rt::npos; ) {
+                ++res;
+                const size_t next = pos + needle.size();
+                const size_t found = char_view_rt(text.c_str() + next, text.size() - next).find(needle);
+                pos = (found == char_view_rt::npos) ? found : next + found;
+            }
+            return res;
+        });
+        PrintResult("find loop", text.size(), base_ns, base_ns);
+        PrintResult("char_view_rt::count", text.size(), MeasureNs([&]() {
+            return view.count(needle);
+        }), base_ns);
+        PrintResult("char_view_rt::find_all (buffer)", text.size(), MeasureNs([&]() {
+            size_t positions[1 << 16];
+            return view.find_all(needle, positions, sizeof(positions) / sizeof(positions[0]));
+        }), base_ns);
+    }
+
+    void BenchCaseInsensitive() {
+        string text = MakeFieldText(1 << 20);
+        for(size_t i = 0; i < text.size(); i += 3)
+            text[i] = static_cast<char>(toupper(text[i]));
+        const char_view_rt view(text.c_str(), text.size());
+        const string needle = "Quoted TEXT here";
+
+        cout << "case-insensitive find, " << text.size() << " bytes:" << endl;
+        const double base_ns = MeasureNs([&]() {
+            size_t res = 0;
+            string lower_text(text), lower_needle(needle);
+            transform(lower_text.begin(), lower_text.end(), lower_text.begin(), ::tolower);
+            transform(lower_needle.begin(), lower_needle.end(), lower_needle.begin(), ::tolower);
+            for(size_t pos = lower_text.find(lower_needle); pos != string::npos; pos = lower_text.find(lower_needle, pos + 1))
+                ++res;
+            return res;
+        });
+        PrintResult("tolower copy + std::string::find", text.size(), base_ns, base_ns);
+        PrintResult("char_view_rt::ifind", text.size(), MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t pos = view.ifind(needle); pos != char_view_rt::npos; ) {
+                ++res;
+                const size_t found = view.substr(pos + 1).ifind(needle);
+                pos = (found == char_view_rt::npos) ? found : pos + 1 + found;
+            }
+            return res;
+        }), base_ns);
+    }
+
+    // Runs find & hash_code on lines of text with given view type
+    template<class View>
+    size_t SearchLines(const string &text) {
+        size_t res = 0;
+        for(size_t pos = 0; pos < text.size(); ) {
+            const View rest(text.c_str() + pos, text.size() - pos);
+            const size_t line_len = min(rest.find("\n"), rest.size());
+            const View line(text.c_str() + pos, line_len);
+            res += line.find("text here") + line.hash_code() + line.ends_with("3.14159");
+            pos += line_len + 1;
+        }
+        return res;
+    }
+
+    void BenchRecursivePolicy() {
+        const string text = MakeFieldText(1 << 20);
+
+        cout << "find, hash_code & ends_with on lines, " << text.size() << " bytes:" << endl;
+        const double base_ns = MeasureNs([&]() { return SearchLines<basic_char_view<char, RecursivePolicyEnabled> >(text); });
+        PrintResult("RecursivePolicyEnabled", text.size(), base_ns, base_ns);
+        PrintResult("RecursivePolicyAuto", text.size(), MeasureNs([&]() {
+            return SearchLines<basic_char_view<char, RecursivePolicyAuto> >(text);
+        }), base_ns);
+        PrintResult("RecursivePolicyDisabled", text.size(), MeasureNs([&]() { return SearchLines<char_view_rt>(text); }), base_ns);
+    }
+
+    void BenchHashCode() {
+        cout << "hash_code, 64 MB of keys:" << endl;
+        const size_t key_sizes[] = { 8, 64, 1024 };
+        for(size_t key_size : key_sizes) {
+            const string keys = MakeFieldText(1 << 16);
+            const size_t key_count = keys.size() / key_size;
+            const size_t rounds = (64 << 20) / keys.size();
+            const double base_ns = MeasureNs([&]() {
+                size_t res = 0;
+                for(size_t r = 0; r < rounds; r++)
+                    for(size_t i = 0; i < key_count; i++)
+                        res += details::no_inline<char>::str_hash_loop(keys.c_str() + i * key_size, 0, key_size);
+                return res;
+            }, 3);
+            const string suffix = " (" + to_string(key_size) + " bytes)";
+            PrintResult("DJB hash (str_hash_loop)" + suffix, rounds * keys.size(), base_ns, base_ns);
+            PrintResult("char_view_rt::hash_code" + suffix, rounds * keys.size(), MeasureNs([&]() {
+                size_t res = 0;
+                for(size_t r = 0; r < rounds; r++)
+                    for(size_t i = 0; i < key_count; i++)
+                        res += char_view_rt(keys.c_str() + i * key_size, key_size).hash_code();
+                return res;
+            }, 3), base_ns);
+        }
+    }
+
+    void BenchConstexprMap() {
+        static const char *keywords[] = { "auto", "bool", "break", "case", "catch", "char", "class", "const", "continue",
+                                          "default", "delete", "do", "double", "else", "enum", "explicit", "extern", "false",
+                                          "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable",
+                                          "namespace", "new", "operator", "private", "protected", "public", "return",
+                                          "short", "signed", "sizeof", "static", "struct", "switch" };
+        const std::pair<char_view_rt, int> items[] = {
+            {keywords[0], 0}, {keywords[1], 1}, {keywords[2], 2}, {keywords[3], 3}, {keywords[4], 4}, {keywords[5], 5},
+            {keywords[6], 6}, {keywords[7], 7}, {keywords[8], 8}, {keywords[9], 9}, {keywords[10], 10}, {keywords[11], 11},
+            {keywords[12], 12}, {keywords[13], 13}, {keywords[14], 14}, {keywords[15], 15}, {keywords[16], 16},
+            {keywords[17], 17}, {keywords[18], 18}, {keywords[19], 19}, {keywords[20], 20}, {keywords[21], 21},
+            {keywords[22], 22}, {keywords[23], 23}, {keywords[24], 24}, {keywords[25], 25}, {keywords[26], 26},
+            {keywords[27], 27}, {keywords[28], 28}, {keywords[29], 29}, {keywords[30], 30}, {keywords[31], 31},
+            {keywords[32], 32}, {keywords[33], 33}, {keywords[34], 34}, {keywords[35], 35}, {keywords[36], 36},
+            {keywords[37], 37}, {keywords[38], 38}, {keywords[39], 39} };
+        const size_t keyword_count = sizeof(keywords) / sizeof(keywords[0]);
+        const auto map = make_constexpr_map(items);
+        unordered_map<string, int> std_map;
+        for(size_t i = 0; i < keyword_count; i++)
+            std_map[keywords[i]] = static_cast<int>(i);
+
+        // identifiers in pseudo-random order, 1 of 10 is not a keyword
+        vector<string> keys;
+        for(size_t i = 0; i < (1 << 16); i++)
+            keys.push_back((i % 10 == 9) ? string("value") : string(keywords[(i * 7919) % keyword_count]));
+        const size_t rounds = 64;
+
+        cout << "keyword lookup, " << rounds * keys.size() << " keys (MB/s = million lookups per second):" << endl;
+        const double base_ns = MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t r = 0; r < rounds; r++)
+                for(const string &key : keys) {
+                    const auto it = std_map.find(key);
+                    res += (it == std_map.end()) ? 0 : it->second;
+                }
+            return res;
+        }, 3);
+        PrintResult("std::unordered_map<string>::find", rounds * keys.size(), base_ns, base_ns);
+        PrintResult("constexpr_map::find", rounds * keys.size(), MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t r = 0; r < rounds; r++)
+                for(const string &key : keys) {
+                    const int *value = map.find(key);
+                    res += value ? *value : 0;
+                }
+            return res;
+        }, 3), base_ns);
+    }
+
+    enum class BenchMethod { get, head, post, put, delete_, connect, options, trace, patch, count };
+
+    void BenchEnumTable() {
+        static const char *names[] = { "GET", "HEAD", "POST", "PUT", "DELETE", "CONNECT", "OPTIONS", "TRACE", "PATCH" };
+        const size_t name_count = static_cast<size_t>(BenchMethod::count);
+        const std::pair<BenchMethod, char_view_rt> items[] = {
+            {BenchMethod::get, names[0]}, {BenchMethod::head, names[1]}, {BenchMethod::post, names[2]},
+            {BenchMethod::put, names[3]}, {BenchMethod::delete_, names[4]}, {BenchMethod::connect, names[5]},
+            {BenchMethod::options, names[6]}, {BenchMethod::trace, names[7]}, {BenchMethod::patch, names[8]} };
+        const auto table = make_enum_table(items);
+        map<string, BenchMethod> std_map;
+        for(size_t i = 0; i < name_count; i++)
+            std_map[names[i]] = static_cast<BenchMethod>(i);
+
+        vector<string> keys;
+        for(size_t i = 0; i < (1 << 16); i++)
+            keys.push_back(names[(i * 7919) % name_count]);
+        const size_t rounds = 64;
+
+        cout << "enum from / to text, " << rounds * keys.size() << " values (MB/s = million conversions per second):" << endl;
+        const double base_ns = MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t r = 0; r < rounds; r++)
+                for(const string &key : keys) {
+                    const auto it = std_map.find(key);
+                    res += static_cast<size_t>(it->second);
+                }
+            return res;
+        }, 3);
+        PrintResult("std::map<string, enum>::find", rounds * keys.size(), base_ns, base_ns);
+        PrintResult("enum_table::find", rounds * keys.size(), MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t r = 0; r < rounds; r++)
+                for(const string &key : keys)
+                    res += static_cast<size_t>(*table.find(key));
+            return res;
+        }, 3), base_ns);
+        PrintResult("enum_table::name", rounds * keys.size(), MeasureNs([&]() {
+            size_t res = 0;
+            for(size_t r = 0; r < rounds; r++)
+                for(size_t i = 0; i < keys.size(); i++)
+                    res += table.name(static_cast<BenchMethod>((i + r) % name_count)).size();
+            return res;
+        }, 3), base_ns);
+    }
+
+    void BenchHashBatch() {
+        // keys from 1 to 16 characters, stored in one buffer or each in its own allocation
+        const string text = MakeFieldText(1 << 16);
+        vector<char_view_rt> views;
+        for(size_t i = 0; i < 4096; i++)
+            views.push_back(char_view_rt(text.c_str() + (i * 97) % (text.size() - 16), 1 + (i * 2654435761u) % 16));
+        vector<unique_ptr<string>> scattered_keys;
+        vector<char_view_rt> scattered_views;
+        for(size_t i = 0; i < (1 << 21); i++)
+            scattered_keys.emplace_back(new string("key_" + to_string((i * 2654435761u) % (1 << 21))));
+        for(size_t i = 0; i < scattered_keys.size(); i++) {
+            const string &key = *scattered_keys[(i * 40503u) % scattered_keys.size()];
+            scattered_views.push_back(char_view_rt(key.c_str(), key.size()));
+        }
+        vector<unsigned long long> hashes(scattered_views.size());
+
+        const size_t rounds = 256;
+        cout << "hash_batch, " << rounds * views.size() << " keys of 1-16 bytes (MB/s = million hashes per second):" << endl;
+        const double base_ns = MeasureNs([&]() {
+            for(size_t r = 0; r < rounds; r++)
+                for(size_t i = 0; i < views.size(); i++)
+                    hashes[i] = views[i].hash_code();
+            return static_cast<size_t>(hashes[0]);
+        });
+        PrintResult("hash_code loop", rounds * views.size(), base_ns, base_ns);
+        PrintResult("hash_batch", rounds * views.size(), MeasureNs([&]() {
+            for(size_t r = 0; r < rounds; r++)
+                hash_batch(views.data(), views.size(), hashes.data());
+            return static_cast<size_t>(hashes[0]);
+        }), base_ns);
+
+        cout << "hash_batch, " << scattered_views.size() << " separately allocated keys:" << endl;
+        const double scattered_base_ns = MeasureNs([&]() {
+            for(size_t i = 0; i < scattered_views.size(); i++)
+                hashes[i] = scattered_views[i].hash_code();
+            return static_cast<size_t>(hashes[0]);
+        });
+        PrintResult("hash_code loop", scattered_views.size(), scattered_base_ns, scattered_base_ns);
+        PrintResult("hash_batch", scattered_views.size(), MeasureNs([&]() {
+            hash_batch(scattered_views.data(), scattered_views.size(), hashes.data());
+            return static_cast<size_t>(hashes[0]);
+        }), scattered_base_ns);
+    }
+
+#if defined(__cpp_lib_generic_unordered_lookup)
+    void BenchTransparentLookup() {
+        // long keys, temporary std::string allocates
+        unordered_map<string, int, char_view_hash, char_view_equal> map;
+        vector<string> keys;
+        for(int i = 0; i < 1024; i++) {
+            keys.push_back("/api/v1/accounts/" + to_string(i * 7919) + "/transactions/recent");
+            map[keys.back()] = i;
+        }
+        const string text = MakeFieldText(1 << 16);
+        vector<char_view_rt> views;
+        for(size_t i = 0; i < (1 << 16); i++)
+            views.push_back((i % 4 == 3) ? char_view_rt(text.c_str() + i % 1000, 40) : char_view_rt(keys[(i * 13) % keys.size()].c_str(), keys[(i * 13) % keys.size()].size()));
+
+        cout << "unordered_map<string> lookup with char_view, " << views.size() << " keys (MB/s = million lookups per second):" << endl;
+        const double base_ns = MeasureNs([&]() {
+            size_t res = 0;
+            for(const char_view_rt &view : views)
+                res += map.count(static_cast<string>(view));
+            return res;
+        });
+        PrintResult("find(std::string(view))", views.size(), base_ns, base_ns);
+        PrintResult("find(view), transparent", views.size(), MeasureNs([&]() {
+            size_t res = 0;
+            for(const char_view_rt &view : views)
+                res += map.count(view);
+            return res;
+        }), base_ns);
+    }
+#endif
+
+    void BenchStreamingHasher() {
+        // message received in network packets
+        const string message = MakeFieldText(1 << 20);
+        const size_t packet_size = 1460;
+
+        cout << "hash of " << message.size() << " bytes in packets of " << packet_size << " bytes:" << endl;
+        const double base_ns = MeasureNs([&]() {
+            string joined;
+            for(size_t pos = 0; pos < message.size(); pos += packet_size)
+                joined.append(message, pos, packet_size);
+            return static_cast<size_t>(char_view_rt(joined.c_str(), joined.size()).hash_code());
+        });
+        PrintResult("join packets + hash_code", message.size(), base_ns, base_ns);
+        PrintResult("char_view_hasher", message.size(), MeasureNs([&]() {
+            char_view_hasher hasher;
+            for(size_t pos = 0; pos < message.size(); pos += packet_size)
+                hasher.update(message.c_str() + pos, min(packet_size, message.size() - pos));
+            return static_cast<size_t>(hasher.finish());
+        }), base_ns);
+    }
+
+    void BenchCaseInsensitiveHash() {
+        cout << "case-insensitive hash, 64 MB of keys:" << endl;
+        const size_t key_sizes[] = { 16, 64, 1024 };
+        for(size_t key_size : key_sizes) {
+            const string keys = MakeFieldText(1 << 16);
+            const size_t key_count = keys.size() / key_size;
+            const size_t rounds = (64 << 20) / keys.size();
+            string lower(key_size, ' ');
+            const double base_ns = MeasureNs([&]() {
+                size_t res = 0;
+                for(size_t r = 0; r < rounds; r++)
+                    for(size_t i = 0; i < key_count; i++) {
+                        const char *key = keys.c_str() + i * key_size;
+                        for(size_t j = 0; j < key_size; j++)
+                            lower[j] = static_cast<char>(tolower(static_cast<unsigned char>(key[j])));
+                        res += char_view_rt(lower.c_str(), key_size).hash_code();
+                    }
+                return res;
+            }, 3);
+            const string suffix = " (" + to_string(key_size) + " bytes)";
+            PrintResult("tolower copy + hash_code" + suffix, rounds * keys.size(), base_ns, base_ns);
+            PrintResult("char_view_rt::ihash_code" + suffix, rounds * keys.size(), MeasureNs([&]() {
+                size_t res = 0;
+                for(size_t r = 0; r < rounds; r++)
+                    for(size_t i = 0; i < key_count; i++)
+                        res += char_view_rt(keys.c_str() + i * key_size, key_size).ihash_code();
+                return res;
+            }, 3), base_ns);
+        }
+    }
+
+    template<class View>
+    size_t DeduplicateKeys(const vector<string> &keys) {
+        unordered_set<View> unique;
+        for(const string &key : keys)
+            unique.insert(View(key.c_str(), key.size()));
+        // join: probe with already built views
+        vector<View> views;
+        views.reserve(keys.size());
+        for(const string &key : keys)
+            views.push_back(View(key.c_str(), key.size()));
+        size_t found = 0;
+        for(int r = 0; r < 4; r++)
+            for(const View &view : views)
+                found += unique.count(view);
+        return unique.size() + found;
+    }
+
+    void BenchHashedView() {
+        // long keys with common prefix, 1 of 4 unique
+        vector<string> keys;
+        for(size_t i = 0; i < (1 << 18); i++)
+            keys.push_back("https://example.com/catalog/products/item-" + to_string((i * 2654435761u) % (1 << 16)));
+        size_t bytes = 0;
+        for(const string &key : keys)
+            bytes += key.size() * 5;
+
+        cout << "deduplicate & probe, " << keys.size() << " keys:" << endl;
+        const double base_ns = MeasureNs([&]() { return DeduplicateKeys<char_view_rt>(keys); }, 3);
+        PrintResult("unordered_set<char_view_rt>", bytes, base_ns, base_ns);
+        PrintResult("unordered_set<hashed_char_view>", bytes, MeasureNs([&]() { return DeduplicateKeys<hashed_char_view>(keys); }, 3), base_ns);
+    }
+
+}
+
+int main()
+{
+    BenchFindFirstOf();
+    BenchTrim();
+    BenchCount();
+    BenchCaseInsensitive();
+    BenchRecursivePolicy();
+    BenchHashCode();
+    BenchConstexprMap();
+    BenchEnumTable();
+    BenchHashedView();
+    BenchHashBatch();
+    BenchStreamingHasher();
+    BenchCaseInsensitiveHash();
+#if defined(__cpp_lib_generic_unordered_lookup)
+    BenchTransparentLookup();
+#endif
+    return 0;
+}
@@ -0,0 +1,380 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        hashBenchMain.cpp
+// Purpose:     Throughput & quality benchmarks for hash functions of char_view.
+// Author:      Piotr Likus
+// Created:     16/10/2026
+// Version:     0.2
+// License:     BSD
+/////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+#include "char_view.h"
+
+using namespace std;
+using namespace sbt;
+
+// views using iterative (runtime) versions of functions
+typedef basic_char_view<char, RecursivePolicyDisabled> char_view_rt;
+
+namespace {
+
+    // prevents compiler from removing benchmarked code
+    volatile size_t bench_sink = 0;
+
+    // Runs function "repeats" times, returns best time in nanoseconds
+    template<typename Func>
+    double MeasureNs(Func func, int repeats = 5) {
+        double best = 0.0;
+        for(int i = 0; i < repeats; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            bench_sink = bench_sink + func();
+            const auto stop = std::chrono::steady_clock::now();
+            const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+            if (i == 0 || ns < best)
+                best = ns;
+        }
+        return best;
+    }
+
+    // Deterministic pseudo-random numbers (xorshift64*), the same data in each run
+    struct Random {
+        unsigned long long state;
+
+        explicit Random(unsigned long long seed) : state(seed | 1) {}
+
+        unsigned long long next() {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 2685821657736338717ULL;
+        }
+
+        size_t below(size_t limit) {
+            return static_cast<size_t>(next() % limit);
+        }
+    };
+
+    // Hash variant: function of text with 64-bit result, output_bits - number of meaningful bits
+    struct HashVariant {
+        const char *name;
+        unsigned long long (*func)(const char *, size_t);
+        int output_bits;
+        bool ignore_case;
+    };
+
+    unsigned long long DjbHash(const char *str, size_t len) {
+        return details::no_inline<char>::str_hash_loop(str, 0, len);
+    }
+
+    unsigned long long HashCode(const char *str, size_t len) {
+        return char_view_rt(str, len).hash_code();
+    }
+
+    unsigned long long SeededHashCode(const char *str, size_t len) {
+        return HashPolicySeeded::hash_chars(str, len, RecursivePolicyDisabled());
+    }
+
+    unsigned long long IHashCode(const char *str, size_t len) {
+        return char_view_rt(str, len).ihash_code();
+    }
+
+    unsigned long long StreamingHash(const char *str, size_t len) {
+        char_view_hasher hasher;
+        hasher.update(str, len);
+        return hasher.finish();
+    }
+
+    // variants with different values, hash_batch & char_view_hasher return values of hash_code
+    const HashVariant quality_variants[] = {
+        { "DJB (str_hash)", DjbHash, 32, false },
+        { "hash_code", HashCode, 64, false },
+        { "hash_code, HashPolicySeeded", SeededHashCode, 64, false },
+        { "ihash_code", IHashCode, 64, true },
+    };
+
+    // Printable text without zero characters (DJB hash stops on zero)
+    string MakeRandomText(size_t size, Random &random) {
+        string res(size, ' ');
+        for(char &ch : res)
+            ch = static_cast<char>(33 + random.below(94));
+        return res;
+    }
+
+    void BenchThroughput() {
+        const size_t key_sizes[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 4096 };
+        const size_t view_count = 4096;
+        Random random(1);
+        const string text = MakeRandomText((1 << 20) + 4096, random);
+
+        vector<string> names;
+        vector<vector<double> > gbps, ns_per_hash;
+        for(size_t key_size : key_sizes) {
+            // keys at various alignments, all in 1 MB of text
+            vector<char_view_rt> views;
+            views.reserve(view_count);
+            for(size_t i = 0; i < view_count; i++)
+                views.push_back(char_view_rt(text.c_str() + ((i * 4099) & ((1 << 20) - 1)), key_size));
+            const size_t rounds = max<size_t>(1, (32 << 20) / (key_size * view_count));
+            const double hashes = static_cast<double>(rounds * view_count);
+
+            size_t variant = 0;
+            auto add = [&](const char *name, double ns) {
+                if (names.size() <= variant) {
+                    names.push_back(name);
+                    gbps.push_back(vector<double>());
+                    ns_per_hash.push_back(vector<double>());
+                }
+                gbps[variant].push_back(hashes * key_size / ns);
+                ns_per_hash[variant].push_back(ns / hashes);
+                variant++;
+            };
+            auto measure = [&](unsigned long long (*func)(const char *, size_t)) {
+                return MeasureNs([&]() {
+                    unsigned long long res = 0;
+                    for(size_t r = 0; r < rounds; r++)
+                        for(const char_view_rt &view : views)
+                            res += func(view.data(), view.size());
+                    return static_cast<size_t>(res);
+                });
+            };
+
+            add("DJB (str_hash)", measure(DjbHash));
+            add("hash_code", measure(HashCode));
+            add("hash_code, HashPolicySeeded", measure(SeededHashCode));
+            add("ihash_code", measure(IHashCode));
+            add("char_view_hasher", measure(StreamingHash));
+            vector<unsigned long long> out(view_count);
+            add("hash_batch", MeasureNs([&]() {
+                unsigned long long res = 0;
+                for(size_t r = 0; r < rounds; r++) {
+                    hash_batch(views.data(), views.size(), out.data());
+                    res += out[r % view_count];
+                }
+                return static_cast<size_t>(res);
+            }));
+        }
+
+        cout << "throughput [GB/s] by key length:" << endl << "  " << left << setw(30) << "" << right;
+        for(size_t key_size : key_sizes)
+            cout << setw(7) << key_size;
+        cout << endl;
+        for(size_t v = 0; v < names.size(); v++) {
+            cout << "  " << left << setw(30) << names[v] << right << fixed << setprecision(2);
+            for(double value : gbps[v])
+                cout << setw(7) << value;
+            cout << endl;
+        }
+
+        cout << "time per hash [ns] by key length:" << endl << "  " << left << setw(30) << "" << right;
+        for(size_t key_size : key_sizes)
+            cout << setw(7) << key_size;
+        cout << endl;
+        for(size_t v = 0; v < names.size(); v++) {
+            cout << "  " << left << setw(30) << names[v] << right << fixed << setprecision(1);
+            for(double value : ns_per_hash[v])
+                cout << setw(7) << value;
+            cout << endl;
+        }
+    }
+
+    vector<string> MakeUrlCorpus(size_t count) {
+        const char *hosts[] = { "example.com", "www.example.org", "api.service.net", "static.cdn.io" };
+        const char *paths[] = { "/catalog/products/item-", "/users/", "/search?q=term", "/docs/v2/page-", "/img/" };
+        vector<string> res;
+        for(size_t i = 0; i < count; i++)
+            res.push_back(string("https://") + hosts[i % 4] + paths[(i / 4) % 5] + to_string(i / 20) +
+                          ((i % 3 == 0) ? "?page=" + to_string(i % 7) : string()));
+        return res;
+    }
+
+    vector<string> MakeIdentifierCorpus(size_t count) {
+        const char *verbs[] = { "get", "set", "find", "update", "remove", "is", "has", "create" };
+        const char *nouns[] = { "User", "Name", "Item", "Order", "Count", "Buffer", "Index", "Value", "Node", "Size" };
+        vector<string> res;
+        for(size_t i = 0; i < count; i++) {
+            string name = verbs[i % 8];
+            name += nouns[(i / 8) % 10];
+            name += nouns[(i / 80) % 10];
+            if (i >= 800)
+                name += to_string(i / 800);
+            // snake case for every other identifier
+            if ((i / 400) % 2 == 1) {
+                string snake;
+                for(char ch : name) {
+                    if (isupper(static_cast<unsigned char>(ch))) {
+                        snake += '_';
+                        ch = static_cast<char>(tolower(static_cast<unsigned char>(ch)));
+                    }
+                    snake += ch;
+                }
+                name = snake;
+            }
+            res.push_back(name);
+        }
+        return res;
+    }
+
+    vector<string> MakeNumericCorpus(size_t count) {
+        vector<string> res;
+        for(size_t i = 0; i < count; i++)
+            res.push_back(to_string(i));
+        return res;
+    }
+
+    // Number of distinct keys for variant (case-insensitive variants treat keys differing in case as equal)
+    size_t CountDistinctKeys(const vector<string> &keys, bool ignore_case) {
+        vector<string> sorted(keys);
+        if (ignore_case)
+            for(string &key : sorted)
+                for(char &ch : key)
+                    ch = details::lower_ascii(ch);
+        sort(sorted.begin(), sorted.end());
+        return static_cast<size_t>(unique(sorted.begin(), sorted.end()) - sorted.begin());
+    }
+
+    size_t CountDistinct(vector<unsigned long long> values) {
+        sort(values.begin(), values.end());
+        return static_cast<size_t>(unique(values.begin(), values.end()) - values.begin());
+    }
+
+    // Chi-square of bucket loads divided by degrees of freedom (1.0 for uniform distribution), returns max bucket load
+    double BucketChiSquare(const vector<unsigned long long> &hashes, size_t bucket_count, bool low_bits, size_t &max_load) {
+        vector<size_t> loads(bucket_count, 0);
+        for(unsigned long long hash : hashes) {
+            const size_t value = static_cast<size_t>(hash);
+            loads[low_bits ? (value & (bucket_count - 1)) : (value % bucket_count)]++;
+        }
+        const double expected = static_cast<double>(hashes.size()) / bucket_count;
+        double chi = 0.0;
+        max_load = 0;
+        for(size_t load : loads) {
+            chi += (load - expected) * (load - expected) / expected;
+            max_load = max(max_load, load);
+        }
+        return chi / (bucket_count - 1);
+    }
+
+    void BenchDistribution(const char *corpus_name, const vector<string> &keys) {
+        // 8 keys per bucket: power of 2 buckets (mask of low bits) & prime number of buckets (as in std::unordered_map)
+        const size_t pow2_buckets = 1 << 14;
+        const size_t prime_buckets = 16381;
+        const double pairs = static_cast<double>(keys.size()) * (keys.size() - 1) / 2;
+
+        cout << "collisions & buckets, " << corpus_name << ", " << keys.size() << " keys (e.g. " << keys[keys.size() / 2] << "):" << endl;
+        cout << "  " << left << setw(30) << "" << right << setw(12) << "coll. 64b" << setw(16) << "coll. 32b (exp)"
+             << setw(12) << "chi2 2^14" << setw(7) << "max" << setw(12) << "chi2 16381" << setw(7) << "max" << endl;
+        for(const HashVariant &variant : quality_variants) {
+            vector<unsigned long long> hashes;
+            hashes.reserve(keys.size());
+            for(const string &key : keys)
+                hashes.push_back(variant.func(key.c_str(), key.size()));
+            const size_t distinct_keys = CountDistinctKeys(keys, variant.ignore_case);
+
+            vector<unsigned long long> hashes32(hashes);
+            for(unsigned long long &hash : hashes32)
+                hash &= 0xFFFFFFFFULL;
+            size_t pow2_max, prime_max;
+            const double pow2_chi = BucketChiSquare(hashes, pow2_buckets, true, pow2_max);
+            const double prime_chi = BucketChiSquare(hashes, prime_buckets, false, prime_max);
+
+            cout << "  " << left << setw(30) << variant.name << right
+                 << setw(12) << (distinct_keys - CountDistinct(hashes))
+                 << setw(8) << (distinct_keys - CountDistinct(hashes32)) << " (" << setw(5) << fixed << setprecision(1) << (pairs / 4294967296.0) << ")"
+                 << setw(12) << setprecision(3) << pow2_chi << setw(7) << pow2_max
+                 << setw(12) << prime_chi << setw(7) << prime_max << endl;
+        }
+    }
+
+    // Flips each input bit of random keys, reports mean probability of output bit change (ideal 0.5) & largest deviation from 0.5
+    void BenchAvalanche() {
+        const size_t key_sizes[] = { 3, 8, 16, 40, 100 };
+        const size_t samples = 2000;
+
+        cout << "avalanche, " << samples << " random keys per length (mean flip probability / worst bias of input-output bit pair):" << endl;
+        cout << "  " << left << setw(30) << "" << right;
+        for(size_t key_size : key_sizes)
+            cout << setw(10) << key_size << setw(7) << "";
+        cout << endl;
+
+        for(const HashVariant &variant : quality_variants) {
+            cout << "  " << left << setw(30) << variant.name << right << fixed << setprecision(3);
+            for(size_t key_size : key_sizes) {
+                Random random(key_size);
+                const size_t input_bits = key_size * 8;
+                vector<size_t> flips(input_bits * variant.output_bits, 0);
+                size_t tested = 0;
+                string key(key_size, ' ');
+                for(size_t s = 0; s < samples; s++) {
+                    // no characters with single bit set: one flip must not create zero character (end of text for DJB)
+                    for(char &ch : key) {
+                        do {
+                            ch = static_cast<char>(random.next() >> 56);
+                        } while ((static_cast<unsigned char>(ch) & (static_cast<unsigned char>(ch) - 1)) == 0);
+                    }
+                    const unsigned long long base = variant.func(key.c_str(), key.size());
+                    for(size_t bit = 0; bit < input_bits; bit++) {
+                        key[bit / 8] = static_cast<char>(key[bit / 8] ^ (1 << (bit % 8)));
+                        const unsigned long long changed = base ^ variant.func(key.c_str(), key.size());
+                        key[bit / 8] = static_cast<char>(key[bit / 8] ^ (1 << (bit % 8)));
+                        for(int out = 0; out < variant.output_bits; out++)
+                            flips[bit * variant.output_bits + out] += (changed >> out) & 1;
+                    }
+                    tested++;
+                }
+
+                double sum = 0.0, worst = 0.0;
+                size_t cells = 0;
+                for(size_t bit = 0; bit < input_bits; bit++) {
+                    // case-insensitive hash ignores case bit of letters by design
+                    if (variant.ignore_case && (bit % 8 == 5))
+                        continue;
+                    for(int out = 0; out < variant.output_bits; out++) {
+                        const double p = static_cast<double>(flips[bit * variant.output_bits + out]) / tested;
+                        sum += p;
+                        worst = max(worst, fabs(p - 0.5));
+                        cells++;
+                    }
+                }
+                cout << setw(10) << (sum / cells) << " /" << setw(5) << worst;
+            }
+            cout << endl;
+        }
+        // largest bias expected from sampling alone (about 4.5 standard deviations for this number of pairs)
+        cout << "  bias from sampling alone: about " << fixed << setprecision(3) << (4.5 * 0.5 / sqrt(static_cast<double>(samples))) << endl;
+    }
+
+    // hash_batch & char_view_hasher must return values of hash_code
+    void CheckConsistency(const vector<string> &keys) {
+        vector<char_view_rt> views;
+        for(const string &key : keys)
+            views.push_back(char_view_rt(key.c_str(), key.size()));
+        vector<unsigned long long> batch(views.size());
+        hash_batch(views.data(), views.size(), batch.data());
+        size_t mismatches = 0;
+        for(size_t i = 0; i < views.size(); i++)
+            mismatches += (batch[i] != views[i].hash_code()) + (StreamingHash(views[i].data(), views[i].size()) != views[i].hash_code());
+        cout << "hash_batch & char_view_hasher equal to hash_code: " << (mismatches == 0 ? "yes" : "NO") << endl;
+    }
+
+}
+
+int main()
+{
+    BenchThroughput();
+    const size_t corpus_size = 1 << 17;
+    const vector<string> urls = MakeUrlCorpus(corpus_size);
+    BenchDistribution("URLs", urls);
+    BenchDistribution("identifiers", MakeIdentifierCorpus(corpus_size));
+    BenchDistribution("numbers", MakeNumericCorpus(corpus_size));
+    BenchAvalanche();
+    CheckConsistency(urls);
+    return 0;
+}
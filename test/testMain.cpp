@@ -14,12 +14,25 @@
 #include <algorithm>
 #include <cctype>
 #include <string>
+#include <vector>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+#include <map>
+#include <cstdint>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 #include "char_view.h"
 
 using namespace std;
 using namespace sbt;
 
+// views using iterative (runtime) versions of functions
+typedef basic_char_view<char, RecursivePolicyDisabled> char_view_rt;
+typedef basic_char_view<wchar_t, RecursivePolicyDisabled> wchar_view_rt;
+
 namespace std {
 
     // to_string is not implemented in tested version of GCC/MinGW
@@ -171,6 +184,7 @@ void testFunc(const char *name, Func f, bool &failed)
         Assert(s2.size() == 5);
         constexpr char_view s3 = s1.substr(12, 5);
         Assert(s3.size() == 1);
+        static_assert(s1.substr(5).size() == 8, "substr(5) without length");
         return true;
     }
 
@@ -251,6 +265,489 @@ void testFunc(const char *name, Func f, bool &failed)
         return true;
     }
 
+    template<typename charT>
+    void AssertHashRuntime(const std::basic_string<charT> &text, const char *name) {
+        for(size_t len = 0; len <= text.size(); len++)
+            Assert(details::hash_chars(text.c_str(), len) == details::rt::hash_chars(text.c_str(), len),
+                   std::string("hash_code, constexpr == runtime ") + name + " [" + std::to_string(len) + "]");
+    }
+
+    bool TestHashCode64() {
+        constexpr unsigned long long h1 = "Content-Length"_cv.hash_code();
+        static_assert(sizeof(h1) == 8, "hash_code is 64-bit");
+        Assert(h1 == char_view_rt("Content-Length").hash_code(), "hash_code, constexpr == runtime");
+        Assert(h1 != "Content-Lengtx"_cv.hash_code(), "hash_code, last char");
+        Assert(char_view("a\0b", 3).hash_code() != char_view("a", 1).hash_code(), "hash_code, embedded zero");
+        Assert(""_cv.hash_code() == char_view_rt("").hash_code(), "hash_code, empty");
+
+        // all length classes: 0..3, 4..16, 17..48, more than 48 bytes
+        std::string text;
+        std::u16string text16;
+        std::u32string text32;
+        std::wstring wtext;
+        for(int i = 0; i < 200; i++) {
+            text += static_cast<char>(i * 37 + i / 7);
+            text16 += static_cast<char16_t>(i * 9973);
+            text32 += static_cast<char32_t>(i * 99991);
+            wtext += static_cast<wchar_t>(i * 31 + 1);
+        }
+        AssertHashRuntime(text, "char");
+        AssertHashRuntime(text16, "char16_t");
+        AssertHashRuntime(text32, "char32_t");
+        AssertHashRuntime(wtext, "wchar_t");
+
+        // no collisions for similar keys, also in low 32 bits
+        std::vector<unsigned long long> hashes;
+        for(int i = 0; i < 20000; i++) {
+            const std::string key = "key" + std::to_string(i);
+            hashes.push_back(char_view_rt(key.c_str(), key.size()).hash_code());
+        }
+        std::sort(hashes.begin(), hashes.end());
+        Assert(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end(), "hash_code, no collisions");
+        for(unsigned long long &h : hashes)
+            h &= 0xFFFFFFFFULL;
+        std::sort(hashes.begin(), hashes.end());
+        Assert(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end(), "hash_code, no collisions (32 bit)");
+        return true;
+    }
+
+    bool TestHashPolicy() {
+        constexpr char_view label("clear");
+        static_assert(label.hash_code() == details::hash_chars("clear", 5), "deterministic hash in compile time");
+        Assert(std::hash<char_view>()(label) == static_cast<size_t>(label.hash_code()), "std::hash uses hash_code");
+        Assert(std::hash<char_view_rt>()(char_view_rt("clear")) == static_cast<size_t>(label.hash_code()), "std::hash, runtime view");
+
+        // seeded hash: stable within process, different than deterministic one
+        const seeded_char_view key("clear");
+        Assert(key.hash_code() == seeded_char_view(std::string("clear").c_str()).hash_code(), "seeded hash is stable");
+        Assert(key.hash_code() != label.hash_code(), "seeded hash differs from deterministic");
+        Assert(key.hash_code() == details::rt::hash_chars("clear", 5, details::rt::process_hash_seed(), details::rt::process_hash_secrets()),
+               "seeded hash value");
+
+        // keys with words cancelling public secret (word ^ hash_secret1 == 0) collide for any seed unless secrets are random
+        std::vector<std::string> crafted;
+        for(char fill = 'a'; fill <= 'h'; ++fill) {
+            std::string short_key(16, fill), long_key(40, fill);
+            for(size_t i = 0; i < 4; ++i) {
+                short_key[i] = static_cast<char>(details::hash_secret1 >> (32 + 8 * i));
+                short_key[8 + i] = static_cast<char>(details::hash_secret1 >> (8 * i));
+            }
+            for(size_t i = 0; i < 8; ++i)
+                long_key[i] = static_cast<char>(details::hash_secret1 >> (8 * i));
+            crafted.push_back(short_key);
+            crafted.push_back(long_key);
+        }
+        Assert(details::rt::hash_chars(crafted[0].data(), 16, 1) == details::rt::hash_chars(crafted[2].data(), 16, 2), "crafted keys, fixed secrets");
+        Assert(details::rt::hash_chars(crafted[1].data(), 40, 1) == details::rt::hash_chars(crafted[1].data(), 40, 2), "crafted long key, fixed secrets");
+        const details::hash_secrets &secrets = details::rt::process_hash_secrets();
+        std::unordered_set<unsigned long long> seeded_hashes;
+        for(const std::string &text : crafted) {
+            seeded_hashes.insert(seeded_char_view(text.data(), text.size()).hash_code());
+            Assert(details::rt::hash_chars(text.data(), text.size(), 1, secrets) != details::rt::hash_chars(text.data(), text.size(), 2, secrets),
+                   "crafted key, seeds with random secrets");
+        }
+        Assert(seeded_hashes.size() == crafted.size(), "crafted keys, seeded hash");
+
+        const std::vector<std::string> names = { "alpha", "beta", "gamma", "" };
+        std::unordered_map<seeded_char_view, int> map;
+        for(size_t i = 0; i < names.size(); i++)
+            map.insert(std::make_pair(seeded_char_view(names[i].c_str(), names[i].size()), static_cast<int>(i)));
+        Assert(map.size() == 4, "seeded map, size");
+        Assert(map.at(seeded_char_view("gamma")) == 2, "seeded map [gamma]");
+        Assert(map.at(seeded_char_view("")) == 3, "seeded map [empty]");
+        Assert(map.find(seeded_char_view("delta")) == map.end(), "seeded map [delta]");
+
+        // constexpr_map does not depend on hash policy of keys
+        const std::pair<seeded_char_view, int> items[] = { {seeded_char_view("get"), 1}, {seeded_char_view("put"), 2} };
+        const auto verbs = make_constexpr_map(items);
+        Assert(*verbs.find(std::string("put")) == 2, "constexpr map with seeded keys [put]");
+        Assert(verbs.at(char_view_rt("get")) == 1, "constexpr map with seeded keys [get]");
+        return true;
+    }
+
+    bool TestHashedView() {
+        constexpr hashed_char_view literal = "select"_cv;
+        static_assert(literal.hash_code() == "select"_cv.hash_code(), "hashed view, hash in compile time");
+        static_assert(literal.size() == 6, "hashed view, size");
+        Assert(literal.view() == "select"_cv, "hashed view, view");
+
+        const std::string text = "select";
+        const hashed_char_view runtime(text);
+        Assert(runtime.hash_code() == literal.hash_code(), "hashed view, runtime hash");
+        Assert(runtime == literal, "hashed view, equal");
+        Assert(runtime != hashed_char_view("selecT"_cv), "hashed view, not equal");
+        Assert(std::hash<hashed_char_view>()(runtime) == std::hash<char_view>()("select"_cv), "hashed view, std::hash");
+
+        // hash is compared before characters
+        const hashed_char_view forced(text.c_str(), text.size(), literal.hash_code() + 1);
+        Assert(forced != literal, "hashed view, different hash");
+
+        // deduplication
+        const std::string words = "to be or not to be that is the question";
+        std::unordered_set<hashed_char_view> unique;
+        size_t start = 0;
+        for(size_t pos = 0; pos <= words.size(); pos++)
+            if ((pos == words.size()) || (words[pos] == ' ')) {
+                unique.insert(hashed_char_view(words.c_str() + start, pos - start));
+                start = pos + 1;
+            }
+        Assert(unique.size() == 8, "hashed view, unique words");
+        Assert(unique.count("not"_cv) == 1, "hashed view, find [not]");
+        Assert(unique.count("no"_cv) == 0, "hashed view, find [no]");
+
+        const hashed_wchar_view wide = L"name"_cv;
+        Assert(static_cast<std::wstring>(wide) == L"name", "hashed view, wide");
+        return true;
+    }
+
+    template<class View>
+    bool HashBatchMatches(const std::vector<View> &views) {
+        std::vector<unsigned long long> hashes(views.size());
+        hash_batch(views.data(), views.size(), hashes.data());
+        for(size_t i = 0; i < views.size(); i++)
+            if (hashes[i] != views[i].hash_code())
+                return false;
+        return true;
+    }
+
+    bool TestHashBatch() {
+        const std::string text = "The quick brown fox jumps over the lazy dog, then runs back home through the forest "
+                                 "and the field, where the lazy dog is still sleeping under an old apple tree.";
+        const std::wstring wide_text(text.begin(), text.end());
+        std::vector<char_view_rt> views;
+        std::vector<seeded_char_view> seeded_views;
+        std::vector<wchar_view_rt> wide_views;
+        for(size_t i = 0; i < 300; i++) {
+            const size_t pos = (i * 7) % 40;
+            const size_t len = (i < 120) ? i % 20 : (i * 13) % 120;
+            views.push_back(char_view_rt(text.c_str() + pos, len));
+            seeded_views.push_back(seeded_char_view(text.c_str() + pos, len));
+            wide_views.push_back(wchar_view_rt(wide_text.c_str() + pos, len));
+        }
+        Assert(HashBatchMatches(views), "hash_batch, char");
+        Assert(HashBatchMatches(seeded_views), "hash_batch, seeded");
+        Assert(HashBatchMatches(wide_views), "hash_batch, wchar_t");
+
+        const std::vector<char_view_rt> few = { char_view_rt(""), char_view_rt("abc") };
+        Assert(HashBatchMatches(few), "hash_batch, short array");
+        hash_batch(views.data(), 0, static_cast<unsigned long long *>(nullptr));
+
+        std::vector<std::uint64_t> fixed_width(views.size());
+        hash_batch(views.data(), views.size(), fixed_width.data());
+        Assert(fixed_width[7] == views[7].hash_code() && fixed_width[299] == views[299].hash_code(), "hash_batch, uint64_t output");
+        return true;
+    }
+
+    // Hashes text in fragments of sizes taken cyclically from list, compares with hash_code
+    template<class Hasher, class View>
+    bool StreamingHashMatches(const View &text, const std::vector<size_t> &fragments) {
+        Hasher hasher;
+        size_t pos = 0;
+        for(size_t i = 0; pos < text.size(); i++) {
+            const size_t len = std::min(fragments[i % fragments.size()], text.size() - pos);
+            hasher.update(text.data() + pos, len);
+            pos += len;
+        }
+        return (hasher.finish() == text.hash_code()) && (hasher.size() == text.size());
+    }
+
+    bool TestStreamingHasher() {
+        std::string text;
+        for(int i = 0; text.size() < 400; i++)
+            text += "fragment-" + std::to_string(i * 31) + ";";
+        const std::wstring wide_text(text.begin(), text.end());
+        const std::vector<std::vector<size_t>> fragmentations = {
+            {1}, {3, 7}, {16}, {17, 5}, {47, 1}, {48}, {49}, {64, 3}, {100, 2, 33}, {1000} };
+
+        bool matches = true;
+        for(size_t len = 0; len <= text.size(); len++)
+            for(const std::vector<size_t> &fragments : fragmentations) {
+                matches = matches && StreamingHashMatches<char_view_hasher>(char_view_rt(text.c_str(), len), fragments);
+                matches = matches && StreamingHashMatches<basic_char_view_hasher<char, HashPolicySeeded>>(seeded_char_view(text.c_str(), len), fragments);
+            }
+        Assert(matches, "streaming hasher, all lengths & fragmentations");
+
+        bool wide_matches = true;
+        for(size_t len = 0; len <= 100; len++)
+            wide_matches = wide_matches && StreamingHashMatches<wchar_view_hasher>(wchar_view_rt(wide_text.c_str(), len), fragmentations[3]);
+        Assert(wide_matches, "streaming hasher, wchar_t");
+
+        char_view_hasher hasher;
+        hasher.update("Hello, "_cv);
+        hasher.update(std::string("world"));
+        Assert(hasher.finish() == "Hello, world"_cv.hash_code(), "streaming hasher, views & strings");
+        hasher.update("!", 1);
+        Assert(hasher.finish() == "Hello, world!"_cv.hash_code(), "streaming hasher, continued after finish");
+        hasher.reset();
+        Assert(hasher.finish() == ""_cv.hash_code(), "streaming hasher, reset");
+        return true;
+    }
+
+    bool TestTransparentFunctors() {
+        const std::string key = "content-type";
+        const char *zkey = "content-type";
+        const char_view_hash hasher;
+        const size_t expected = static_cast<size_t>("content-type"_cv.hash_code());
+        Assert(hasher(key) == expected, "transparent hash, std::string");
+        Assert(hasher(zkey) == expected, "transparent hash, zstring");
+        Assert(hasher("content-type") == expected, "transparent hash, literal");
+        Assert(hasher("content-type"_cv) == expected, "transparent hash, char_view");
+        Assert(hasher(char_view_rt(key.c_str(), key.size())) == expected, "transparent hash, char_view_rt");
+        Assert(hasher(hashed_char_view("content-type"_cv)) == expected, "transparent hash, hashed view");
+        Assert(hasher(std::string()) == static_cast<size_t>(""_cv.hash_code()), "transparent hash, empty");
+#if __cplusplus >= 201703L
+        Assert(hasher(std::string_view(key)) == expected, "transparent hash, std::string_view");
+#endif
+
+        const char_view_equal equal;
+        Assert(equal(key, "content-type"_cv), "transparent equal, string & view");
+        Assert(equal(zkey, key), "transparent equal, zstring & string");
+        Assert(!equal("content"_cv, key), "transparent equal, prefix");
+        Assert(!equal(key, "content-typf"), "transparent equal, last character");
+
+        const char_view_less less;
+        Assert(less("abc"_cv, std::string("abd")), "transparent less, abc < abd");
+        Assert(less("ab", "abc"_cv), "transparent less, ab < abc");
+        Assert(!less(std::string("abc"), "abc"), "transparent less, equal");
+        Assert(!less("b"_cv, "abc"), "transparent less, b > abc");
+
+        std::unordered_map<std::string, int, char_view_hash, char_view_equal> headers;
+        headers["content-type"] = 1;
+        headers["content-length"] = 2;
+        Assert(headers.at("content-length") == 2, "transparent unordered_map, at");
+#if defined(__cpp_lib_generic_unordered_lookup)
+        Assert(headers.find("content-length"_cv)->second == 2, "transparent unordered_map, find char_view");
+        Assert(headers.count("host"_cv) == 0, "transparent unordered_map, missing");
+#endif
+
+#if __cplusplus >= 201402L
+        std::map<std::string, int, char_view_less> ordered = { {"alpha", 1}, {"beta", 2}, {"gamma", 3} };
+        Assert(ordered.find("beta"_cv)->second == 2, "transparent map, find char_view");
+        Assert(ordered.find("delta"_cv) == ordered.end(), "transparent map, missing");
+        Assert(ordered.lower_bound("c"_cv)->first == "gamma", "transparent map, lower_bound");
+#endif
+        return true;
+    }
+
+    template<typename charT>
+    void AssertIHashRuntime(const std::basic_string<charT> &text, const char *name) {
+        std::basic_string<charT> lower(text);
+        for(charT &ch : lower)
+            ch = details::lower_ascii(ch);
+        for(size_t len = 0; len <= text.size(); len++) {
+            const unsigned long long expected = details::hash_chars(lower.c_str(), len);
+            Assert(details::ihash_chars(text.c_str(), len) == expected,
+                   std::string("ihash_code, constexpr == hash of lower case ") + name + " [" + std::to_string(len) + "]");
+            Assert(details::rt::ihash_chars(text.c_str(), len) == expected,
+                   std::string("ihash_code, runtime == hash of lower case ") + name + " [" + std::to_string(len) + "]");
+        }
+    }
+
+    bool TestCaseInsensitiveHash() {
+        static_assert("Content-Type"_cv.ihash_code() == "content-TYPE"_cv.ihash_code(), "ihash_code in compile time");
+        static_assert("Content-Type"_cv.ihash_code() == "content-type"_cv.hash_code(), "ihash_code is hash of lower case");
+        Assert(char_view_rt("CONTENT-type").ihash_code() == "content-type"_cv.ihash_code(), "ihash_code, runtime view");
+        Assert("Content-Type"_cv.ihash_code() != "Content-Typf"_cv.ihash_code(), "ihash_code, different text");
+
+        // letters mixed with characters next to letter ranges & non-ASCII characters which must not be converted
+        const char specials[] = { 'A', 'z', '@', '[', '`', '{', 'Q', 'm', '\xC1', '\xDA', 'Z', 'a' };
+        std::string text;
+        std::u16string text16;
+        std::u32string text32;
+        std::wstring wtext;
+        for(int i = 0; i < 300; i++) {
+            const char ch = specials[(i * 7 + i / 13) % sizeof(specials)];
+            text += ch;
+            text16 += (i % 5 == 0) ? static_cast<char16_t>(0x0141 + i) : static_cast<char16_t>(static_cast<unsigned char>(ch));
+            text32 += (i % 3 == 0) ? static_cast<char32_t>(0x10041 + i) : static_cast<char32_t>(static_cast<unsigned char>(ch));
+            wtext += (i % 4 == 0) ? static_cast<wchar_t>(0x0100 + 'A') : static_cast<wchar_t>(static_cast<unsigned char>(ch));
+        }
+        AssertIHashRuntime(text, "char");
+        AssertIHashRuntime(text16, "char16_t");
+        AssertIHashRuntime(text32, "char32_t");
+        AssertIHashRuntime(wtext, "wchar_t");
+        Assert(u"\u0141"_cv.ihash_code() != u"\u0161"_cv.ihash_code(), "ihash_code, non-ASCII letters not converted");
+
+        const char_view_ihash ihasher;
+        Assert(ihasher(std::string("HOST")) == ihasher("host"_cv), "transparent ihash, string & view");
+        const char_view_iequal iequal;
+        Assert(iequal(std::string("HOST"), "host"_cv), "transparent iequal, string & view");
+        Assert(!iequal("hosts", "HOST"), "transparent iequal, different length");
+        Assert(!iequal("hose", "HOST"), "transparent iequal, last character");
+
+        std::unordered_map<std::string, int, char_view_ihash, char_view_iequal> headers;
+        headers["Content-Type"] = 1;
+        headers["content-type"] = 2;
+        Assert(headers.size() == 1, "case-insensitive unordered_map, one key");
+        Assert(headers.at("CONTENT-TYPE") == 2, "case-insensitive unordered_map, at");
+#if defined(__cpp_lib_generic_unordered_lookup)
+        Assert(headers.find("content-TYPE"_cv) != headers.end(), "case-insensitive unordered_map, find char_view");
+#endif
+        return true;
+    }
+
+    // 4 KB literal: recursive C++11 versions exceed default constexpr depth for such texts
+#define CV_TEST_TEXT64 "The quick brown fox jumps over the lazy dog; 0123456789-ABCDEFGH"
+#define CV_TEST_TEXT1K CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 \
+                       CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64 CV_TEST_TEXT64
+#define CV_TEST_TEXT4K CV_TEST_TEXT1K CV_TEST_TEXT1K CV_TEST_TEXT1K CV_TEST_TEXT1K " END "
+
+    bool TestConstexprLongText() {
+        constexpr char_view text(CV_TEST_TEXT4K, sizeof(CV_TEST_TEXT4K) - 1);
+#ifdef CV_HAS_CONSTEXPR14
+        static_assert(char_view(CV_TEST_TEXT4K).size() == 4101, "long text, length");
+        static_assert(text.find("END") == 4097, "long text, find");
+        static_assert(text.rfind("fox") == 4096 - 64 + 16, "long text, rfind");
+        static_assert(text.contains("ABCDEFGH END"), "long text, contains");
+        static_assert(!text.contains("fox jumps under"), "long text, contains missing");
+        static_assert(text.starts_with(CV_TEST_TEXT1K), "long text, starts_with");
+        static_assert(text.ends_with(CV_TEST_TEXT64 " END "), "long text, ends_with");
+        static_assert(text.equals(CV_TEST_TEXT4K), "long text, equals");
+        static_assert(text.compare(CV_TEST_TEXT1K) > 0, "long text, compare");
+        static_assert(text.find_first_of("-") == 55, "long text, find_first_of");
+        static_assert(text.find_last_not_of(" ") == 4099, "long text, find_last_not_of");
+        static_assert(text.trim().size() == 4100 && details::length(CV_TEST_TEXT4K) == 4101, "long text, trim & length");
+        static_assert(text.icontains("ghijkl") == false && text.ifind("abcdefgh end") == 4088, "long text, ifind");
+        static_assert(text.hash_code() != 0, "long text, hash_code");
+#endif
+        const std::string copy(CV_TEST_TEXT4K);
+        Assert(text.hash_code() == char_view_rt(copy.c_str(), copy.size()).hash_code(), "long text, hash_code constexpr == runtime");
+        Assert(text.find("END") == copy.find("END"), "long text, find");
+        Assert(text.rfind("fox") == copy.rfind("fox"), "long text, rfind");
+        Assert(text.find_last_of("x") == copy.find_last_of("x"), "long text, find_last_of");
+        Assert(text.trim().size() == copy.size() - 1, "long text, trim");
+        return true;
+    }
+
+    template<class View>
+    std::string DescribeSearches(const View &text, const View &needle) {
+        return std::to_string(text.find(needle)) + "," + std::to_string(text.rfind(needle)) + "," +
+               std::to_string(text.find_first_of(needle)) + "," + std::to_string(text.find_last_not_of(needle)) + "," +
+               std::to_string(text.starts_with(needle)) + std::to_string(text.ends_with(needle)) +
+               std::to_string(text.contains(needle)) + std::to_string(text.equals(needle)) + "," +
+               std::to_string(text.compare(needle.data(), needle.size())) + "," + std::to_string(text.ifind(needle)) + "," +
+               std::to_string(text.trim().size()) + "," + std::to_string(text.hash_code());
+    }
+
+    bool TestRecursivePolicyAuto() {
+        typedef basic_char_view<char, RecursivePolicyAuto> char_view_auto;
+        typedef basic_char_view<char, RecursivePolicyEnabled> char_view_rec;
+#if defined(CV_DEF_RECURSIVE) && defined(CV_DEF_RECURSIVE_AUTO)
+        static_assert(std::is_same<char_view::recursive_policy, RecursivePolicyAuto>::value, "auto policy is default");
+#endif
+        // constant evaluation
+        constexpr char_view_auto path("/usr/local/include/char_view.h");
+        static_assert(path.find("include") == 11, "auto policy, constexpr find");
+        static_assert(path.rfind("/") == 18, "auto policy, constexpr rfind");
+        static_assert(path.starts_with("/usr") && path.ends_with(".h"), "auto policy, constexpr starts_with & ends_with");
+        static_assert(path.compare("/usr") == 1 && path.equals("/usr/local/include/char_view.h"), "auto policy, constexpr compare");
+        static_assert(path.find_first_of("._") == 23 && path.ifind("LOCAL") == 5, "auto policy, constexpr find_first_of & ifind");
+        static_assert(path.hash_code() == char_view_rec("/usr/local/include/char_view.h").hash_code(), "auto policy, constexpr hash_code");
+
+        // runtime: the same results as recursive & iterative versions
+        const char *texts[] = { "", "a", "  padded text  ", "The sixth sick sheik's sixth sheep's sick.", "sick", "abcabcabcabc" };
+        const char *needles[] = { "", "sick", "s", "abc", " ", "The sixth sick sheik's sixth sheep's sick.", "SIXTH" };
+        bool same = true;
+        for(const char *text : texts)
+            for(const char *needle : needles) {
+                const std::string expected = DescribeSearches(char_view_rec(text), char_view_rec(needle));
+                same = same && (DescribeSearches(char_view_auto(text), char_view_auto(needle)) == expected) &&
+                               (DescribeSearches(char_view_rt(text), char_view_rt(needle)) == expected);
+            }
+        Assert(same, "auto policy, runtime == recursive");
+
+        const std::string long_text = std::string(1000, 'x') + "needle" + std::string(1000, 'y') + "  ";
+        const char_view_auto long_view(long_text.c_str(), long_text.size());
+        Assert(long_view.find("needle") == 1000, "auto policy, runtime find");
+        Assert(long_view.rfind("x") == 999, "auto policy, runtime rfind");
+        Assert(long_view.trim().size() == long_text.size() - 2, "auto policy, runtime trim");
+        Assert(long_view.starts_with(std::string(1000, 'x')) && !long_view.starts_with(long_text + "z"), "auto policy, runtime starts_with");
+        Assert(long_view.ends_with("y  ") && !long_view.ends_with(("z" + long_text).c_str()), "auto policy, runtime ends_with");
+
+        // non-ASCII & embedded zero characters: constant evaluation gives the same results as runtime
+        constexpr char_view_auto high("\xe9", 1);
+        constexpr int high_cmp = high.compare("a");
+        static_assert(high_cmp == 1 && char_view_auto("a").compare("\xe9", 1) == -1, "auto policy, constexpr non-ASCII compare");
+        Assert(char_view_rt("\xe9", 1).compare("a") == high_cmp && high.compare("a") == high_cmp, "auto policy, runtime non-ASCII compare");
+
+        constexpr char_view_auto zeros("a\0b", 3);
+        constexpr bool zeros_equal = zeros.equals("a\0c", 3) || zeros.starts_with("a\0c", 3);
+        constexpr int zeros_cmp = zeros.compare("a\0c", 3);
+        constexpr int zeros_zstr_cmp = zeros.compare("a");
+        static_assert(!zeros_equal && zeros.equals("a\0b", 3) && zeros.starts_with("a\0", 2) && zeros.ends_with("\0b", 2), "auto policy, constexpr zero inside");
+        static_assert(zeros_cmp == -1 && zeros_zstr_cmp == 1 && !zeros.equals("a"), "auto policy, constexpr compare with zero inside");
+        const char_view_rt zeros_rt("a\0b", 3);
+        Assert(!zeros_rt.equals("a\0c", 3) && !zeros_rt.starts_with("a\0c", 3) && !zeros.equals("a\0c", 3), "auto policy, runtime equals with zero inside");
+        Assert(zeros_rt.compare("a\0c", 3) == zeros_cmp && zeros.compare("a\0c", 3) == zeros_cmp, "auto policy, runtime compare with zero inside");
+        Assert(zeros_rt.compare("a") == zeros_zstr_cmp && zeros.compare("a") == zeros_zstr_cmp, "auto policy, runtime compare with zstring");
+
+        const std::string odd_texts[] = { std::string("a\0b", 3), std::string("a\0c", 3), std::string("\0", 1), "\xe9t\xe9", "\x80", "a" };
+        for(const std::string &text : odd_texts)
+            for(const std::string &needle : odd_texts) {
+                const std::string expected = DescribeSearches(char_view_rt(text.data(), text.size()), char_view_rt(needle.data(), needle.size()));
+                same = same && (DescribeSearches(char_view_rec(text.data(), text.size()), char_view_rec(needle.data(), needle.size())) == expected) &&
+                               (DescribeSearches(char_view_auto(text.data(), text.size()), char_view_auto(needle.data(), needle.size())) == expected);
+            }
+        Assert(same, "auto policy, non-ASCII & zero inside, recursive == runtime");
+        return true;
+    }
+
+#ifdef CV_HAS_CLASS_NTTP
+    // type specialized by route text
+    template<basic_fixed_string Route>
+    struct TestRouteHandler {
+        static constexpr unsigned long long id = Route.hash_code();
+        static constexpr bool is_api = Route.starts_with("/api/");
+        static constexpr size_t name_pos = Route.rfind("/") + 1;
+    };
+
+    template<basic_fixed_string Route> struct TestDocHandler {
+        static constexpr unsigned long long id = Route.hash_code();
+        static constexpr bool is_api = Route.starts_with("/api/");
+    };
+#endif
+
+    bool TestFixedString() {
+        const auto entry = make_fixed_string("key=value");
+        Assert(entry.size() == 9 && !entry.empty(), "fixed_string, size");
+        Assert(std::string(entry.c_str()) == "key=value", "fixed_string, c_str");
+        Assert(entry.view().data() == entry.data(), "fixed_string, view without copy");
+        Assert(entry.find("=") == 3 && entry.find("value") == 4 && entry.rfind("e") == 8, "fixed_string, find");
+        Assert(entry.substr(4) == "value"_cv && entry.front(3) == "key"_cv, "fixed_string, substr");
+        Assert(entry.istarts_with("KEY") && entry.find_first_of("=e") == 1, "fixed_string, other searches");
+        Assert(entry == "key=value"_cv && "key=value"_cv == entry && entry != "key"_cv, "fixed_string, compare with view");
+        Assert(entry == make_fixed_string("key=value") && entry != make_fixed_string("key=valuf") && entry != make_fixed_string("key"),
+               "fixed_string, compare");
+        Assert(std::hash<fixed_string<9>>()(entry) == std::hash<char_view>()("key=value"_cv), "fixed_string, std::hash");
+        Assert(static_cast<std::string>(entry) == "key=value", "fixed_string, conversion to std::string");
+        Assert(make_fixed_string(u"\u0141odz").ihash_code() == u"\u0141ODZ"_cv.ihash_code(), "fixed_string, char16_t");
+
+#ifdef CV_HAS_CONSTEXPR14
+        static constexpr fixed_string<15> request("GET /index.html");
+        static_assert(request.size() == 15 && request[4] == '/', "fixed_string, compile-time size & index");
+        static_assert(request.starts_with("GET ") && request.ends_with(".html"_cv), "fixed_string, compile-time starts_with & ends_with");
+        static_assert(request.find("/") == 4 && request.find_last_of("./") == 10, "fixed_string, compile-time find");
+        static_assert(request.substr(4).equals("/index.html"), "fixed_string, compile-time substr");
+        static_assert(request.hash_code() == "GET /index.html"_cv.hash_code(), "fixed_string, compile-time hash_code");
+        static_assert(request.compare(make_fixed_string("GET /")) > 0, "fixed_string, compile-time compare");
+#endif
+
+#ifdef CV_HAS_CLASS_NTTP
+        static_assert(TestRouteHandler<"/api/users">::is_api && !TestRouteHandler<"/static/app.js">::is_api, "fixed_string template argument");
+        static_assert(TestRouteHandler<"/api/users">::id == "/api/users"_cv.hash_code(), "fixed_string template argument, hash_code");
+        static_assert(TestRouteHandler<"/static/app.js">::name_pos == 8, "fixed_string template argument, rfind");
+        static_assert(std::is_same<TestRouteHandler<"/a">, TestRouteHandler<fixed_string<2>("/a")>>::value,
+                      "fixed_string template argument, equal texts give the same type");
+        static_assert(!std::is_same<TestRouteHandler<"/a">, TestRouteHandler<"/b">>::value,
+                      "fixed_string template argument, different texts give different types");
+
+        // form used in documentation of basic_fixed_string
+        TestDocHandler<"/api/users"> users;
+        static_assert(decltype(users)::is_api && decltype(users)::id == "/api/users"_cv.hash_code(), "fixed_string, documented example");
+#endif
+        return true;
+    }
+
     bool TestHashCodeSwitch() {
         std::string s1("abc");
 
@@ -287,6 +784,225 @@ void testFunc(const char *name, Func f, bool &failed)
         return true;
     }
 
+    int DispatchCommand(const std::string &command) {
+        CV_STRING_SWITCH(commands, "clear"_cv, "print"_cv, "list"_cv, ""_cv);
+        switch (commands(command)) {
+            case commands.label("clear"):
+                return 1;
+            case commands.label("print"):
+                return 2;
+            case commands.label("list"):
+                return 3;
+            case commands.label(""):
+                return 4;
+            default:
+                return 0;
+        }
+    }
+
+    bool TestStringSwitch() {
+        Assert(DispatchCommand("clear") == 1, "string switch [clear]");
+        Assert(DispatchCommand("print") == 2, "string switch [print]");
+        Assert(DispatchCommand("list") == 3, "string switch [list]");
+        Assert(DispatchCommand("") == 4, "string switch [empty]");
+        Assert(DispatchCommand("lis") == 0, "string switch [lis]");
+        Assert(DispatchCommand("clear ") == 0, "string switch [clear+space]");
+
+        constexpr auto duplicated = make_string_switch("a"_cv, "b"_cv, "a"_cv);
+        static_assert(!duplicated.distinct(), "string switch, duplicated label");
+        static_assert(duplicated.size() == 3, "string switch, size");
+
+        constexpr auto wide = make_string_switch(L"get"_cv, L"put"_cv);
+        static_assert(wide.distinct(), "string switch, wide");
+        Assert(wide(wchar_view_rt(L"put")) == wide.label(L"put"), "string switch [wide put]");
+        Assert(wide(L"pu") == wide.no_match, "string switch [wide pu]");
+
+        // labels located by binary search of hashes
+        constexpr auto keywords = make_string_switch("auto"_cv, "bool"_cv, "break"_cv, "case"_cv, "catch"_cv, "char"_cv,
+            "class"_cv, "const"_cv, "continue"_cv, "default"_cv, "delete"_cv, "do"_cv, "double"_cv, "else"_cv, "enum"_cv,
+            "explicit"_cv, "extern"_cv, "false"_cv, "float"_cv, "for"_cv, "friend"_cv, "goto"_cv, "if"_cv);
+        static_assert(keywords.distinct(), "string switch, keywords");
+        const char *keyword_names[] = { "auto", "bool", "break", "case", "catch", "char", "class", "const", "continue",
+            "default", "delete", "do", "double", "else", "enum", "explicit", "extern", "false", "float", "for", "friend", "goto", "if" };
+        bool found = true;
+        for(const char *name : keyword_names)
+            found = found && (keywords(std::string(name)) == keywords.label(name)) && (keywords(std::string(name) + "_") == keywords.no_match);
+        Assert(found, "string switch, all keywords found");
+        Assert(keywords("int") == keywords.no_match && keywords("") == keywords.no_match, "string switch, keywords [int]");
+
+#ifdef CV_HAS_CONSTEXPR14
+        // 300 labels: order of hashes is sorted in a loop, within default constexpr limits
+#define CV_TEST_LABELS10(p) p "0"_cv, p "1"_cv, p "2"_cv, p "3"_cv, p "4"_cv, p "5"_cv, p "6"_cv, p "7"_cv, p "8"_cv, p "9"_cv
+#define CV_TEST_LABELS100(p) CV_TEST_LABELS10(p "0"), CV_TEST_LABELS10(p "1"), CV_TEST_LABELS10(p "2"), CV_TEST_LABELS10(p "3"), \
+    CV_TEST_LABELS10(p "4"), CV_TEST_LABELS10(p "5"), CV_TEST_LABELS10(p "6"), CV_TEST_LABELS10(p "7"), CV_TEST_LABELS10(p "8"), CV_TEST_LABELS10(p "9")
+        CV_STRING_SWITCH(methods, CV_TEST_LABELS100("get_"), CV_TEST_LABELS100("set_"), CV_TEST_LABELS100("del_"));
+#undef CV_TEST_LABELS100
+#undef CV_TEST_LABELS10
+        static_assert(methods.size() == 300, "string switch, 300 labels");
+        Assert(methods("set_42") == methods.label("set_42") && methods("del_99") == methods.label("del_99"), "string switch, 300 labels [set_42]");
+        Assert(methods("get_100") == methods.no_match && methods("get_") == methods.no_match, "string switch, 300 labels [get_100]");
+#endif
+
+        // labels with seeded hash policy: switch hashes labels & input with deterministic hash
+        const auto seeded = make_string_switch(seeded_char_view("clear"), seeded_char_view("print"));
+        Assert(seeded("print") == seeded.label("print") && seeded.label("print") == "print"_cv.hash_code(), "string switch, seeded labels [print]");
+        Assert(seeded(seeded_char_view("clear")) == seeded.label("clear"), "string switch, seeded labels [clear]");
+        Assert(seeded("prin") == seeded.no_match, "string switch, seeded labels [prin]");
+        return true;
+    }
+
+    bool TestConstexprMap() {
+#ifdef CV_HAS_CONSTEXPR14
+        constexpr auto verbs = make_constexpr_map<char_view, int>({
+            {"GET"_cv, 1}, {"PUT"_cv, 2}, {"POST"_cv, 3}, {"DELETE"_cv, 4}, {"HEAD"_cv, 5}, {""_cv, 6} });
+        static_assert(verbs.size() == 6, "constexpr map, size");
+        static_assert(verbs.at("POST"_cv) == 3, "constexpr map, at");
+        static_assert(verbs.contains(""_cv), "constexpr map, empty key");
+        static_assert(!verbs.contains("GE"_cv), "constexpr map, prefix");
+        static_assert(verbs.find("PATCH"_cv) == nullptr, "constexpr map, find missing");
+        Assert(*verbs.find(std::string("DELETE")) == 4, "constexpr map [DELETE]");
+        Assert(*verbs.find("HEADER", 4) == 5, "constexpr map [HEAD]");
+        Assert(*verbs.find("GET") == 1 && verbs.find("GE") == nullptr, "constexpr map, zstring [GET]");
+#endif
+
+        // map built in runtime
+        const char *names[] = { "auto", "bool", "break", "case", "catch", "char", "class", "const", "continue",
+                                "default", "delete", "do", "double", "else", "enum", "explicit", "extern", "false",
+                                "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable",
+                                "namespace", "new", "operator", "private", "protected", "public", "return" };
+        const std::pair<char_view_rt, int> items[] = {
+            {names[0], 0}, {names[1], 1}, {names[2], 2}, {names[3], 3}, {names[4], 4}, {names[5], 5}, {names[6], 6},
+            {names[7], 7}, {names[8], 8}, {names[9], 9}, {names[10], 10}, {names[11], 11}, {names[12], 12},
+            {names[13], 13}, {names[14], 14}, {names[15], 15}, {names[16], 16}, {names[17], 17}, {names[18], 18},
+            {names[19], 19}, {names[20], 20}, {names[21], 21}, {names[22], 22}, {names[23], 23}, {names[24], 24},
+            {names[25], 25}, {names[26], 26}, {names[27], 27}, {names[28], 28}, {names[29], 29}, {names[30], 30},
+            {names[31], 31}, {names[32], 32}, {names[33], 33} };
+        const auto map = make_constexpr_map(items);
+        bool found = (map.size() == 34);
+        for(int i = 0; i < 34; i++)
+            found = found && map.contains(char_view_rt(names[i])) && (map.at(char_view(names[i])) == i);
+        Assert(found, "constexpr map, all keys found");
+        Assert(!map.contains(char_view_rt("in")), "constexpr map [in]");
+        Assert(map.find(std::string("returns")) == nullptr, "constexpr map [returns]");
+        const std::string verb("namespace");
+        Assert(*map.find(verb.c_str()) == 27 && map.find("") == nullptr, "constexpr map, zstring [namespace]");
+
+        bool thrown = false;
+        try {
+            map.at(char_view_rt("missing"));
+        } catch(const std::out_of_range &) {
+            thrown = true;
+        }
+        Assert(thrown, "constexpr map, at throws for missing key");
+
+        thrown = false;
+        try {
+            std::pair<char_view_rt, int> duplicated[] = { {char_view_rt("a"), 1}, {char_view_rt("b"), 2}, {char_view_rt("a"), 3} };
+            make_constexpr_map(duplicated);
+        } catch(const std::logic_error &) {
+            thrown = true;
+        }
+        Assert(thrown, "constexpr map, duplicated key");
+        return true;
+    }
+
+    enum class TestColor { red, green, blue, cyan };
+    enum TestStatus { status_ok = 200, status_created = 201, status_not_found = 404, status_missing = 405 };
+
+    bool TestEnumTable() {
+#ifdef CV_HAS_CONSTEXPR14
+        constexpr auto colors = make_enum_table<TestColor>({
+            {TestColor::red, "red"_cv}, {TestColor::green, "green"_cv}, {TestColor::blue, "blue"_cv}, {TestColor::blue, "navy"_cv} });
+        static_assert(colors.size() == 4, "enum table, size");
+        static_assert(colors.name(TestColor::green) == "green"_cv, "enum table, name");
+        static_assert(colors.name(TestColor::blue) == "blue"_cv, "enum table, first name of value");
+        static_assert(colors.at("navy"_cv) == TestColor::blue, "enum table, alias");
+        static_assert(colors.at("red"_cv) == TestColor::red, "enum table, at");
+        static_assert(colors.find("gray"_cv) == nullptr, "enum table, find missing");
+        static_assert(!colors.contains(TestColor::cyan) && colors.name(TestColor::cyan).empty(), "enum table, value without name");
+        Assert(*colors.find(std::string("green")) == TestColor::green, "enum table [green]");
+        Assert(*colors.find("blues", 4) == TestColor::blue, "enum table [blue]");
+        Assert(colors.find(char_view_rt("Red")) == nullptr, "enum table [Red]");
+
+        // sparse values need range of dense array
+        constexpr auto statuses = make_enum_table<TestStatus, char_view, 206>({
+            {status_ok, "OK"_cv}, {status_created, "Created"_cv}, {status_not_found, "Not Found"_cv} });
+        static_assert(statuses.name(status_not_found) == "Not Found"_cv, "enum table, sparse values");
+        static_assert(!statuses.contains(status_missing) && !statuses.contains(static_cast<TestStatus>(199)), "enum table, outside of range");
+        static_assert(statuses.at("Created"_cv) == status_created, "enum table, sparse at");
+
+        CV_ENUM_TABLE(named_colors, TestColor, {TestColor::red, "red"_cv}, {TestColor::green, "green"_cv});
+        static_assert(named_colors.name(TestColor::red) == "red"_cv, "enum table, macro");
+        static_assert(!enum_names_unique<TestColor, char_view>({{TestColor::red, "red"_cv}, {TestColor::green, "red"_cv}}),
+                      "enum table, duplicated name detected");
+#endif
+
+        // table built in runtime
+        const std::pair<TestColor, char_view_rt> items[] = {
+            {TestColor::cyan, char_view_rt("cyan")}, {TestColor::blue, char_view_rt("blue")}, {TestColor::green, char_view_rt("green")} };
+        const auto table = make_enum_table(items);
+        Assert(table.name(TestColor::cyan) == "cyan"_cv && table.name(TestColor::blue) == "blue"_cv, "enum table, runtime name");
+        Assert(!table.contains(TestColor::red) && table.find(char_view_rt("red")) == nullptr, "enum table, runtime value without name");
+        Assert(table.at(char_view_rt("green")) == TestColor::green, "enum table, runtime at");
+        Assert(*table.find("cyan") == TestColor::cyan && table.find("cya") == nullptr, "enum table, zstring find");
+
+        bool thrown = false;
+        try {
+            const std::pair<TestColor, char_view_rt> duplicated[] = {
+                {TestColor::red, char_view_rt("red")}, {TestColor::green, char_view_rt("red")} };
+            make_enum_table(duplicated);
+        } catch(const std::logic_error &) {
+            thrown = true;
+        }
+        Assert(thrown, "enum table, duplicated name");
+
+        thrown = false;
+        try {
+            const std::pair<TestStatus, char_view_rt> sparse[] = {
+                {status_ok, char_view_rt("OK")}, {status_not_found, char_view_rt("Not Found")} };
+            make_enum_table(sparse);
+        } catch(const std::logic_error &) {
+            thrown = true;
+        }
+        Assert(thrown, "enum table, value outside of range");
+        return true;
+    }
+
+    bool TestSplit() {
+        constexpr char_view config("host=a;port=b;mode=c");
+        static_assert(count_split(config, ';') == 3, "count_split");
+        static_assert(count_split(config, "=") == 4 && count_split(config, ""_cv) == 1, "count_split, string delimiter");
+        static_assert(count_split(""_cv, ';') == 1 && count_split(";;"_cv, ';') == 3, "count_split, empty fields");
+
+        constexpr auto fields = split<count_split(config, ';')>(config, ';');
+        static_assert(fields.size() == 3, "split, size");
+        static_assert(fields[0] == "host=a"_cv && fields[1] == "port=b"_cv && fields[2] == "mode=c"_cv, "split, fields");
+        constexpr auto port = split<2>(fields[1], '=');
+        static_assert(port[0] == "port"_cv && port[1] == "b"_cv, "split, key & value");
+
+        constexpr auto head = split<2>(config, ";");
+        static_assert(head[0] == "host=a"_cv && head[1] == "port=b;mode=c"_cv, "split, last field contains rest of text");
+
+        constexpr auto padded = split<5>("a, b, , c"_cv, ", "_cv);
+        static_assert(padded[0] == "a"_cv && padded[1] == "b"_cv && padded[2].empty() && padded[3] == "c"_cv, "split, string delimiter");
+        static_assert(padded[4].empty() && padded[4].data() == padded[3].data() + 1, "split, missing fields at end of text");
+
+        constexpr auto trailing = split<3>("x;"_cv, ';');
+        static_assert(trailing[0] == "x"_cv && trailing[1].empty() && trailing[2].empty(), "split, trailing delimiter");
+        constexpr auto whole = split<2>("abc"_cv, ""_cv);
+        static_assert(whole[0] == "abc"_cv && whole[1].empty(), "split, empty delimiter");
+
+        // runtime text
+        const std::string text("GET /index.html HTTP/1.1");
+        const auto parts = split<3>(char_view_rt(text.c_str(), text.size()), ' ');
+        Assert(parts[0] == "GET"_cv && parts[1] == "/index.html"_cv && parts[2] == "HTTP/1.1"_cv, "split, runtime");
+        Assert(parts[1].data() == text.c_str() + 4, "split, views point into text");
+        Assert(count_split(char_view_rt(text.c_str(), text.size()), ' ') == 3, "count_split, runtime");
+        const auto wide = split<2>(u"\u0141;x"_cv, u';');
+        Assert(wide[0] == u"\u0141"_cv && wide[1] == u"x"_cv, "split, char16_t");
+        return true;
+    }
+
     bool CompareHash(const char *text) {
         return (details::str_hash(text) == details::no_inline<char>::str_hash_loop(text));
     }
@@ -507,6 +1223,287 @@ void testFunc(const char *name, Func f, bool &failed)
         return true;
     }
 
+    bool TestFindRuntime() {
+        std::string text;
+        for(int i = 0; i < 300; i++)
+            text += static_cast<char>('a' + (i * 7 + i / 13) % 26);
+        text += "needle-at-the-end";
+
+        const char_view_rt s1(text.c_str(), text.size());
+
+        // needles of various lengths taken from various positions, including block boundaries
+        for(size_t len = 1; len <= 40; len++) {
+            for(size_t pos = 0; pos + len <= text.size(); pos += 11) {
+                std::string needle = text.substr(pos, len);
+                Assert(s1.find(needle) == text.find(needle), "find-rt [" + needle + "]");
+                Assert(s1.find_cn(needle.c_str(), len) == text.find(needle), "find_cn-rt [" + needle + "]");
+                Assert(s1.contains(needle.c_str()), "contains-rt [" + needle + "]");
+            }
+        }
+
+        Assert(s1.find("needle-at-the-end") == text.size() - 17, "find-rt [needle-at-the-end]");
+        Assert(s1.find("needle-at-the-end!") == char_view_rt::npos, "find-rt [needle-at-the-end!]");
+        Assert(s1.find("zz") == text.find("zz"), "find-rt [zz]");
+        Assert(s1.find("") == 0, "find-rt []");
+        Assert(!s1.contains("ab-c"), "contains-rt [ab-c]");
+        Assert(s1.contains(char_view_rt("end", 3)), "contains-rt [end]");
+
+        const char_view_rt s2("Abcdefg");
+        Assert(s2.find_cn("Abcdefgij", 7) == 0, "find-rt [Abcdefgij, 7]");
+        Assert(s2.find("Abcdefgij") == char_view_rt::npos, "find-rt [Abcdefgij]");
+        Assert(s2.find("g") == 6, "find-rt [g]");
+
+        const wchar_view_rt sw1(L"The sixth sick sheik's sixth sheep's sick.");
+        Assert(sw1.find(L"sixth") == 4, "find-rt [wide sixth]");
+        Assert(sw1.find(L"sick.") == sw1.size() - 5, "find-rt [wide sick.]");
+        Assert(sw1.find(L"sixty") == wchar_view_rt::npos, "find-rt [wide sixty]");
+        return true;
+    }
+
+    template<size_t N>
+    void AssertFindLiteral(const std::string &text, const char (&needle)[N]) {
+        const char_view s1(text.c_str(), text.size());
+        Assert(s1.find_literal(needle) == text.find(needle), std::string("find_literal [") + needle + "]");
+        Assert(s1.contains_literal(needle) == (text.find(needle) != std::string::npos), std::string("contains_literal [") + needle + "]");
+    }
+
+    bool TestFindLiteral() {
+        std::string text;
+        for(int i = 0; i < 200; i++)
+            text += static_cast<char>('a' + (i * 7 + i / 13) % 26);
+        text += "GET /index.html HTTP/1.1\r\nHost: example.com\r\n\r\n";
+
+        AssertFindLiteral(text, "");
+        AssertFindLiteral(text, "G");
+        AssertFindLiteral(text, "GE");
+        AssertFindLiteral(text, "GET");
+        AssertFindLiteral(text, "GET ");
+        AssertFindLiteral(text, "HTTP/");
+        AssertFindLiteral(text, "\r\nHost");
+        AssertFindLiteral(text, "HTTP/1.1");
+        AssertFindLiteral(text, "Host: example");
+        AssertFindLiteral(text, "example.com\r\n\r\n");
+        AssertFindLiteral(text, "GET /index.html HTTP/1.1\r\n");
+        AssertFindLiteral(text, "POST");
+        AssertFindLiteral(text, "HTTP/2.0");
+        AssertFindLiteral(text, "example.org\r\n\r\n");
+        for(size_t pos = 0; pos + 4 <= 200; pos += 7) {
+            const char needle[5] = { text[pos], text[pos + 1], text[pos + 2], text[pos + 3], '\0' };
+            AssertFindLiteral(text, needle);
+        }
+
+        Assert("GET"_cv.find_literal("GET /") == char_view::npos, "find_literal [longer]");
+        Assert(L"The sixth sick sheik's sixth sheep's sick."_cv.find_literal(L"sheep") == 29, "find_literal [wide]");
+        Assert(U"The sixth sick sheik's sixth sheep's sick."_cv.contains_literal(U"sick."), "contains_literal [char32]");
+        return true;
+    }
+
+    // reference implementation of count (non-overlapping)
+    size_t CountStd(const std::string &text, const std::string &needle) {
+        size_t res = 0;
+        for(size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size()))
+            ++res;
+        return res;
+    }
+
+    bool TestSearcher() {
+        std::string text;
+        for(int i = 0; i < 500; i++)
+            text += static_cast<char>('a' + (i * 7 + i / 13) % 5);
+        const char_view s1(text.c_str(), text.size());
+
+        // short (Horspool), long (Two-Way) and single character needles
+        for(size_t len = 1; len <= 70; len += 3) {
+            for(size_t pos = 0; pos + len <= text.size(); pos += 37) {
+                std::string needle = text.substr(pos, len);
+                const char_view_searcher searcher(char_view(needle.c_str(), needle.size()));
+                Assert(searcher.find(s1) == text.find(needle), "searcher.find [" + needle + "]");
+                Assert(searcher.rfind(s1) == text.rfind(needle), "searcher.rfind [" + needle + "]");
+                Assert(searcher.count(s1) == CountStd(text, needle), "searcher.count [" + needle + "]");
+            }
+        }
+
+        // periodic needles, worst case for naive search
+        std::string periodic(1000, 'a');
+        const char_view s2(periodic.c_str(), periodic.size());
+        std::string needle_a(40, 'a');
+        Assert(char_view_searcher(needle_a.c_str(), needle_a.size()).find(s2) == 0, "searcher.find [a*40]");
+        Assert(char_view_searcher(needle_a.c_str(), needle_a.size()).rfind(s2) == 960, "searcher.rfind [a*40]");
+        Assert(char_view_searcher(needle_a.c_str(), needle_a.size()).count(s2) == 25, "searcher.count [a*40]");
+        std::string needle_ab = std::string(39, 'a') + "b";
+        Assert(char_view_searcher(needle_ab.c_str(), needle_ab.size()).find(s2) == char_view::npos, "searcher.find [a*39b]");
+        std::string needle_ba = "b" + std::string(39, 'a');
+        Assert(char_view_searcher(needle_ba.c_str(), needle_ba.size()).rfind(s2) == char_view::npos, "searcher.rfind [ba*39]");
+
+        const char_view_searcher empty(""_cv);
+        Assert(empty.find(s1) == 0, "searcher.find []");
+        Assert(empty.rfind(s1) == s1.size(), "searcher.rfind []");
+        Assert(char_view_searcher("sheep"_cv).find("ship"_cv) == char_view::npos, "searcher.find [longer]");
+
+        const wchar_view_searcher sw(L"sixth"_cv);
+        Assert(sw.find(L"The sixth sick sheik's sixth sheep's sick."_cv) == 4, "searcher.find [wide sixth]");
+        Assert(sw.rfind(L"The sixth sick sheik's sixth sheep's sick."_cv) == 23, "searcher.rfind [wide sixth]");
+        Assert(sw.count(L"The sixth sick sheik's sixth sheep's sick."_cv) == 2, "searcher.count [wide sixth]");
+
+        // wide characters sharing shift table slot (equal lowest 8 bits)
+        std::u32string wide_text(300, U'\x1100');
+        std::u32string wide_needle(35, U'\x1100');
+        wide_needle[0] = U'\x2100';
+        wide_text.replace(200, 35, wide_needle);
+        const char32_view_searcher sw2(wide_needle.c_str(), wide_needle.size());
+        Assert(sw2.find(wide_text.c_str(), wide_text.size()) == 200, "searcher.find [char32, shared slot]");
+        Assert(sw2.rfind(wide_text.c_str(), wide_text.size()) == 200, "searcher.rfind [char32, shared slot]");
+        return true;
+    }
+
+    std::vector<size_t> FindAllStd(const std::string &text, const std::string &needle, bool overlapping) {
+        std::vector<size_t> res;
+        const size_t step = (overlapping || needle.empty()) ? 1 : needle.size();
+        for(size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + step))
+            res.push_back(pos);
+        return res;
+    }
+
+    bool TestFindAll() {
+        std::string text;
+        for(int i = 0; i < 300; i++)
+            text += static_cast<char>('a' + (i * 7 + i / 13) % 3);
+        const char_view_rt s1(text.c_str(), text.size());
+
+        for(size_t len = 1; len <= 20; len += 3) {
+            for(size_t pos = 0; pos + len <= text.size(); pos += 41) {
+                const std::string needle = text.substr(pos, len);
+                const char_view_rt needle_view(needle.c_str(), needle.size());
+                for(int overlapping = 0; overlapping < 2; overlapping++) {
+                    const overlap_mode mode = overlapping ? overlap_mode::overlapping : overlap_mode::non_overlapping;
+                    const std::vector<size_t> expected = FindAllStd(text, needle, overlapping != 0);
+                    const std::string name = " [" + needle + "," + std::to_string(overlapping) + "]";
+
+                    Assert(s1.count(needle_view, mode) == expected.size(), "count" + name);
+                    std::vector<size_t> found;
+                    s1.find_all(needle_view, std::back_inserter(found), mode);
+                    Assert(found == expected, "find_all" + name);
+
+                    size_t buffer[4];
+                    const size_t written = s1.find_all(needle_view, buffer, 4, mode);
+                    Assert(written == std::min<size_t>(4, expected.size()), "find_all (buffer) size" + name);
+                    Assert(std::equal(buffer, buffer + written, expected.begin()), "find_all (buffer)" + name);
+                }
+            }
+        }
+
+        Assert("aaaa"_cv.count("aa", 2) == 2, "count [aa]");
+        Assert("aaaa"_cv.count("aa", 2, overlap_mode::overlapping) == 3, "count [aa] overlapping");
+        Assert("abc"_cv.count("", 0) == 4, "count [empty]");
+        Assert("abc"_cv.count("abcd", 4) == 0, "count [longer]");
+        Assert(L"x-y-z"_cv.count(L"-"_cv) == 2, "count [wide]");
+        size_t positions[3];
+        Assert(L"ababab"_cv.find_all(L"ab"_cv, positions, 3) == 3, "find_all [wide]");
+        Assert(positions[2] == 4, "find_all [wide] pos");
+        Assert("abc"_cv.find_all("b"_cv, positions, 0) == 0, "find_all [zero cap]");
+        return true;
+    }
+
+    std::string LowerAscii(std::string text) {
+        for(char &ch : text)
+            if ((ch >= 'A') && (ch <= 'Z'))
+                ch = static_cast<char>(ch - 'A' + 'a');
+        return text;
+    }
+
+    bool TestCaseInsensitive() {
+        static_assert("Content-Length"_cv.iequals("content-length"), "iequals [constexpr]");
+        static_assert(!"Content-Length"_cv.iequals("content-lengt"), "iequals [constexpr, shorter]");
+        static_assert("SELECT * FROM t"_cv.istarts_with("select"), "istarts_with [constexpr]");
+        static_assert("SELECT * FROM t"_cv.iends_with("from T"_cv), "iends_with [constexpr]");
+        static_assert("SELECT * FROM t"_cv.ifind("from") == 9, "ifind [constexpr]");
+        static_assert("SELECT * FROM t"_cv.icontains("* f"), "icontains [constexpr]");
+        static_assert("SELECT"_cv.ifind("x") == char_view::npos, "ifind [constexpr, not found]");
+
+        Assert(L"Accept-Encoding"_cv.iequals(L"ACCEPT-ENCODING"), "iequals [wide]");
+        Assert(u"Accept-Encoding"_cv.ifind(u"encoding") == 7, "ifind [u16]");
+        Assert(!"[@`{"_cv.iequals("{`@["), "iequals [letter neighbours]");
+        Assert(!"\xc0"_cv.iequals("\xe0"), "iequals [non-ascii]");
+        Assert(char_view_rt("Host").iequals(std::string("hOST")), "iequals-rt [std::string]");
+
+        // runtime versions on texts long enough for SIMD blocks
+        std::string text;
+        for(int i = 0; i < 300; i++) {
+            const char ch = static_cast<char>('a' + (i * 7 + i / 13) % 4);
+            text += (i % 3 == 0) ? static_cast<char>(ch - 'a' + 'A') : ch;
+        }
+        const std::string lower_text = LowerAscii(text);
+        const char_view_rt s1(text.c_str(), text.size());
+
+        for(size_t len = 1; len <= 70; len += 3) {
+            for(size_t pos = 0; pos + len <= text.size(); pos += 29) {
+                // needle with case changed at other positions than in text
+                std::string needle = text.substr(pos, len);
+                for(size_t i = 0; i < needle.size(); i += 2)
+                    needle[i] = static_cast<char>((needle[i] >= 'a') ? needle[i] - 'a' + 'A' : needle[i] - 'A' + 'a');
+                const std::string lower_needle = LowerAscii(needle);
+                const std::string name = " [" + needle + "]";
+
+                Assert(s1.ifind(needle) == lower_text.find(lower_needle), "ifind-rt" + name);
+                Assert(s1.icontains(needle.c_str(), needle.size()), "icontains-rt" + name);
+                Assert(s1.substr(pos).istarts_with(needle), "istarts_with-rt" + name);
+                Assert(s1.substr(0, pos + len).iends_with(needle), "iends_with-rt" + name);
+                Assert(s1.substr(pos, len).iequals(needle), "iequals-rt" + name);
+                needle[len / 2] = '#';
+                Assert(!s1.substr(pos, len).iequals(needle), "iequals-rt (different)" + name);
+                Assert(s1.ifind(needle) == char_view_rt::npos, "ifind-rt (not found)" + name);
+            }
+        }
+        return true;
+    }
+
+    bool TestMatcher() {
+        const char_view_matcher m1 = { "he"_cv, "she"_cv, "his"_cv, "hers"_cv, ""_cv };
+        Assert(m1.size() == 5, "matcher.size == 5");
+
+        constexpr char_view s1("ushers");
+        char_view_match first = m1.find(s1);
+        Assert(first.pos == 1, "matcher.find(ushers).pos == 1");
+        Assert(first.size == 3, "matcher.find(ushers).size == 3");
+        Assert(first.pattern_index == 1, "matcher.find(ushers).pattern_index == 1");
+
+        std::vector<char_view_match> all;
+        m1.find_all(s1, std::back_inserter(all));
+        Assert(all.size() == 3, "matcher.find_all(ushers).size == 3");
+        Assert(all[0].pattern_index == 1 && all[0].pos == 1, "matcher.find_all(ushers)[0] == she");
+        Assert(all[1].pattern_index == 0 && all[1].pos == 2, "matcher.find_all(ushers)[1] == he");
+        Assert(all[2].pattern_index == 3 && all[2].pos == 2, "matcher.find_all(ushers)[2] == hers");
+
+        Assert(m1.contains("this"_cv), "matcher.contains(this)");
+        Assert(!m1.contains("tree"_cv), "matcher.contains(tree)");
+        Assert(m1.find(""_cv).pos == char_view_matcher::npos, "matcher.find([]) == npos");
+
+        // compare with contains() called for each pattern
+        std::vector<char_view> tokens = { "select"_cv, "union"_cv, "drop"_cv, "--"_cv, "/*"_cv, "sleep("_cv, "on"_cv };
+        const char_view_matcher m2(tokens.begin(), tokens.end());
+        const char *payloads[] = { "id=1 union select", "name=jo", "x=sleep(5)", "a/b*c", "c--", "drop", "o" };
+        for(const char *payload : payloads) {
+            const char_view text(payload);
+            bool expected = false;
+            for(const char_view &token : tokens)
+                expected = expected || text.contains(token);
+            Assert(m2.contains(text) == expected, std::string("matcher.contains [") + payload + "]");
+        }
+
+        const wchar_view_matcher mw = { L"\x263A"_cv, L"ok"_cv };
+        Assert(mw.find(L"look \x263A"_cv).pos == 2, "matcher.find [wide]");
+        Assert(mw.find(L"\x263A!"_cv).pattern_index == 0, "matcher.find [wide, char >= 256]");
+
+        const basic_char_view_matcher<char, 16> mf = { "GET"_cv, "POST"_cv, "PUT"_cv };
+        Assert(mf.find("HTTP PUT /"_cv).pattern_index == 2, "matcher.find [fixed]");
+#ifdef CV_HAS_CONSTEXPR14
+        constexpr basic_char_view_matcher<char, 16> mc = { "GET"_cv, "POST"_cv, "PUT"_cv };
+        static_assert(mc.contains("HTTP POST /"_cv), "matcher.contains [constexpr]");
+        static_assert(mc.find("HTTP POST /"_cv).pos == 5, "matcher.find [constexpr]");
+#endif
+        return true;
+    }
+
     bool TestRFind() {
         constexpr char_view s1("The sixth sick sheik's sixth sheep's sick.");
 
@@ -524,6 +1521,36 @@ void testFunc(const char *name, Func f, bool &failed)
         return true;
     }
 
+    bool TestRFindRuntime() {
+        std::string text = "/usr/local/share/doc/";
+        for(int i = 0; i < 300; i++)
+            text += static_cast<char>('a' + (i * 7 + i / 13) % 26);
+        text += "/file.txt";
+
+        const char_view_rt s1(text.c_str(), text.size());
+
+        for(size_t len = 1; len <= 40; len++) {
+            for(size_t pos = 0; pos + len <= text.size(); pos += 11) {
+                std::string needle = text.substr(pos, len);
+                Assert(s1.rfind(needle) == text.rfind(needle), "rfind-rt [" + needle + "]");
+                Assert(s1.rfind_cn(needle.c_str(), len) == text.rfind(needle), "rfind_cn-rt [" + needle + "]");
+            }
+        }
+
+        Assert(s1.rfind("/") == text.size() - 9, "rfind-rt [/]");
+        Assert(s1.rfind("/usr") == 0, "rfind-rt [/usr]");
+        Assert(s1.rfind_cn("/usr", 4) == 0, "rfind_cn-rt [/usr, 4]");
+        Assert(s1.rfind_cn("file.txt!", 8) == text.size() - 8, "rfind_cn-rt [file.txt!, 8]");
+        Assert(s1.rfind("file.txt!") == char_view_rt::npos, "rfind-rt [file.txt!]");
+        Assert(s1.rfind("") == text.size(), "rfind-rt []");
+        Assert(char_view_rt("ab", 2).rfind("abc") == char_view_rt::npos, "rfind-rt [longer]");
+
+        const wchar_view_rt sw1(L"The sixth sick sheik's sixth sheep's sick.");
+        Assert(sw1.rfind(L"sixth") == 23, "rfind-rt [wide sixth]");
+        Assert(sw1.rfind_cn(L"The", 3) == 0, "rfind_cn-rt [wide The, 3]");
+        return true;
+    }
+
     bool TestFindFirstOf() {
         constexpr char_view s1("The sixth sick sheik's sixth sheep's sick.");
 
@@ -651,6 +1678,81 @@ void testFunc(const char *name, Func f, bool &failed)
         return true;
     }
 
+    bool TestCharSet() {
+        constexpr char_set delims(",;\t\n");
+        static_assert(delims.contains(';'), "char_set.contains [;]");
+        static_assert(!delims.contains('a'), "char_set.contains [a]");
+        Assert(delims.size() == 4, "char_set.size == 4");
+
+        constexpr char_view s1("key=value;other,last\tx");
+        static_assert(s1.find_first_of(delims) == 9, "find_first_of [set]");
+        Assert(s1.find_last_of(delims) == 20, "find_last_of [set]");
+        Assert(s1.find_first_not_of(char_set("yek")) == 3, "find_first_not_of [set]");
+        Assert(s1.find_last_not_of(char_set("x\t")) == 19, "find_last_not_of [set]");
+        Assert(s1.find_first_of(char_set("")) == char_view::npos, "find_first_of [empty set]");
+        Assert(s1.find_first_of(char_set("#")) == char_view::npos, "find_first_of [#]");
+
+        const char_set high_chars("\xe9\xff");
+        Assert("caf\xe9"_cv.find_first_of(high_chars) == 3, "find_first_of [high chars]");
+
+        // same results for runtime version, both overloads (set & string)
+        std::string text;
+        for(int i = 0; i < 200; i++)
+            text += static_cast<char>(' ' + (i * 7 + i / 13) % 90);
+        const char_view_rt s2(text.c_str(), text.size());
+        const char *sets[] = { "", "a", ",;", "xyz{}", "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "!\"#$%&'()*+,-./0123456789" };
+        for(const char *set : sets) {
+            const char_set cs(set);
+            const std::string name = std::string("[") + set + "]";
+            Assert(s2.find_first_of(cs) == text.find_first_of(set), "find_first_of-rt " + name);
+            Assert(s2.find_first_of(set) == text.find_first_of(set), "find_first_of-rt (str) " + name);
+            Assert(s2.find_first_not_of(cs) == text.find_first_not_of(set), "find_first_not_of-rt " + name);
+            Assert(s2.find_first_not_of(set) == text.find_first_not_of(set), "find_first_not_of-rt (str) " + name);
+            Assert(s2.find_last_of(cs) == text.find_last_of(set), "find_last_of-rt " + name);
+            Assert(s2.find_last_of(set) == text.find_last_of(set), "find_last_of-rt (str) " + name);
+            Assert(s2.find_last_not_of(cs) == text.find_last_not_of(set), "find_last_not_of-rt " + name);
+            Assert(s2.find_last_not_of(set) == text.find_last_not_of(set), "find_last_not_of-rt (str) " + name);
+        }
+
+        // wide characters, including ones sharing bitmap slot (equal lowest 8 bits)
+        constexpr wchar_set wide_set(L"\x141\x263A");
+        static_assert(wide_set.contains(L'\x141'), "wchar_set.contains [x141]");
+        static_assert(!wide_set.contains(L'\x241'), "wchar_set.contains [x241]");
+        static_assert(!wide_set.contains(L'A'), "wchar_set.contains [A]");
+        Assert(L"A\x241\x141"_cv.find_first_of(wide_set) == 2, "find_first_of [wide set]");
+        Assert(wchar_view_rt(L"\x263A\x241A").find_last_of(wide_set) == 0, "find_last_of-rt [wide set]");
+        Assert(wchar_view_rt(L"\x263A\x241A").find_first_not_of(wide_set) == 1, "find_first_not_of-rt [wide set]");
+        return true;
+    }
+
+    bool TestCharSetBlocks() {
+        // long texts, so block (vectorized) classification is used
+        const char *sets[] = {
+            ",", " \t\r\n", ";,.|", "0123456789", "\x80\xff,",
+            // more than 8 rows of 16 codes: nibble tables are not exact
+            "\x01\x12#4EVgx\x89\x9a\xab",
+            "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ" };
+        constexpr char_set filler("q");
+        for(const char *set : sets) {
+            const char_set cs(set);
+            const std::string name = std::string("[") + set + "]";
+            for(size_t len = 0; len < 100; len += 7) {
+                std::string text(len, 'q');
+                for(size_t pos = 0; pos <= len; pos++) {
+                    if (pos < len)
+                        text[pos] = set[0] ? set[(pos * 5) % std::strlen(set)] : 'x';
+                    const char_view_rt s(text.c_str(), text.size());
+                    Assert(s.find_first_of(cs) == text.find_first_of(set), "find_first_of-blocks " + name);
+                    Assert(s.find_first_not_of(filler) == text.find_first_not_of('q'), "find_first_not_of-blocks [q]");
+                    Assert(s.find_first_not_of(cs) == text.find_first_not_of(set), "find_first_not_of-blocks " + name);
+                    if (pos < len)
+                        text[pos] = 'q';
+                }
+            }
+        }
+        return true;
+    }
+
     bool TestAlgReverse() {
         constexpr char_view s1("Abcdefg");
         char destiny[] = "Abcdefg";
@@ -777,6 +1879,49 @@ void testFunc(const char *name, Func f, bool &failed)
         constexpr auto sw2b = U"  \t u32t1  \t "_cv;
         Assert(sw2b.trim().size() == 5, "trim(u32t-string).len == 5");
 
+        static_assert("  \t test1 \r\n"_cv.trim().size() == 5, "trim(constexpr).len == 5");
+        static_assert(" \t test1"_cv.trim_left().size() == 5, "trim_left(constexpr).len == 5");
+        static_assert("test1 \n "_cv.trim_right().size() == 5, "trim_right(constexpr).len == 5");
+
+        return true;
+    }
+
+    template<typename charT>
+    bool AssertTrimPadded(const char *name) {
+        typedef basic_char_view<charT, RecursivePolicyDisabled> view_type;
+        const charT white[] = { ' ', '\t', '\r', '\n' };
+        // fixed-width fields: value padded with white space on both sides, lengths crossing block sizes
+        for(size_t left = 0; left < 40; left += 3) {
+            for(size_t right = 0; right < 40; right += 5) {
+                for(size_t value_len = 0; value_len < 3; value_len++) {
+                    std::basic_string<charT> text;
+                    for(size_t i = 0; i < left; i++)
+                        text += white[i % 4];
+                    text += std::basic_string<charT>(value_len, charT('v'));
+                    for(size_t i = 0; i < right; i++)
+                        text += white[(i + 1) % 4];
+                    if (value_len == 2)
+                        text[left] = charT(0x0b); // vertical tab is not trimmed
+
+                    const view_type view(text.c_str(), text.size());
+                    const std::string msg = std::string(name) + " [" + std::to_string(left) + "," + std::to_string(right) + "]";
+                    Assert(view.trim().size() == value_len, "trim-rt " + msg);
+                    Assert(view.trim_left().size() == ((value_len == 0) ? 0 : text.size() - left), "trim_left-rt " + msg);
+                    Assert(view.trim_right().size() == ((value_len == 0) ? 0 : left + value_len), "trim_right-rt " + msg);
+                    if (value_len > 0)
+                        Assert(view.trim().data() == text.c_str() + left, "trim-rt data " + msg);
+                }
+            }
+        }
+        return true;
+    }
+
+    bool TestTrimRuntime() {
+        AssertTrimPadded<char>("char");
+        AssertTrimPadded<wchar_t>("wchar_t");
+        AssertTrimPadded<char16_t>("char16_t");
+        AssertTrimPadded<char32_t>("char32_t");
+        Assert(char_view_rt("\xa0x\xa0").trim().size() == 3, "trim-rt [non-ascii]");
         return true;
     }
 
@@ -800,7 +1945,21 @@ int main()
     TEST_FUNC(Empty);
     TEST_FUNC(FrontBack);
     TEST_FUNC(HashCode);
+    TEST_FUNC(HashCode64);
+    TEST_FUNC(HashPolicy);
+    TEST_FUNC(HashedView);
+    TEST_FUNC(HashBatch);
+    TEST_FUNC(TransparentFunctors);
+    TEST_FUNC(StreamingHasher);
+    TEST_FUNC(CaseInsensitiveHash);
+    TEST_FUNC(ConstexprLongText);
+    TEST_FUNC(RecursivePolicyAuto);
+    TEST_FUNC(FixedString);
     TEST_FUNC(HashCodeSwitch);
+    TEST_FUNC(StringSwitch);
+    TEST_FUNC(ConstexprMap);
+    TEST_FUNC(EnumTable);
+    TEST_FUNC(Split);
     TEST_FUNC(HashComp);
     TEST_FUNC(StartsWith);
     TEST_FUNC(EndsWith);
@@ -809,11 +1968,20 @@ int main()
     TEST_FUNC(CompOperators);
     TEST_FUNC(Contains);
     TEST_FUNC(Find);
+    TEST_FUNC(FindRuntime);
+    TEST_FUNC(FindLiteral);
+    TEST_FUNC(Searcher);
+    TEST_FUNC(FindAll);
+    TEST_FUNC(CaseInsensitive);
+    TEST_FUNC(Matcher);
     TEST_FUNC(RFind);
+    TEST_FUNC(RFindRuntime);
     TEST_FUNC(FindFirstOf);
     TEST_FUNC(FindFirstNotOf);
     TEST_FUNC(FindLastOf);
     TEST_FUNC(FindLastNotOf);
+    TEST_FUNC(CharSet);
+    TEST_FUNC(CharSetBlocks);
     TEST_FUNC(AlgReverse);
     TEST_FUNC(AlgAllOf);
 
@@ -827,6 +1995,7 @@ int main()
 
     TEST_FUNC(UtilToString);
     TEST_FUNC(Trim);
+    TEST_FUNC(TrimRuntime);
 
     if (errorFound) {
         cout << "Failures!\n";